@@ -262,7 +262,8 @@ if should_generate_png_assets "$TARGET_BOARD"; then
         "$SCRIPT_DIR/assets/png" \
         "$SCRIPT_DIR/src/app/png_assets.cpp" \
         "$SCRIPT_DIR/src/app/png_assets.h" \
-        --prefix "img_"
+        --prefix "img_" \
+        --compress "${PNG_ASSETS_COMPRESS:-none}"
     echo ""
 else
     echo "Skipping PNG asset generation (no display build or no PNGs)."
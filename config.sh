@@ -63,11 +63,17 @@ declare -A FQBN_TARGETS=(
     ["esp32c3-withsensors"]="esp32:esp32:nologo_esp32c3_super_mini:CDCOnBoot=cdc,PartitionScheme=ota_1_9mb" # ESP32-C3 Super Mini + sensors sample (OTA partitions)
     ["esp32-p4-lcd4b"]="esp32:esp32:esp32p4:FlashSize=32M,PSRAM=enabled,PartitionScheme=ota_8mb_32MB" # ESP32-P4 Waveshare WIFI6-Touch-LCD-4B (720x720 MIPI-DSI + GT911 touch; 32MB + 32MB PSRAM)
     ["jc4880p433"]="esp32:esp32:esp32p4:FlashSize=16M,PSRAM=enabled,PartitionScheme=ota_6mb_16MB,USBMode=hwcdc,CDCOnBoot=cdc" # ESP32-P4 GUITION JC4880P433 (480x800 MIPI-DSI ST7701 + GT911 touch; 16MB + 32MB PSRAM)
+    ["esp32s3-headless"]="esp32:esp32:esp32s3:FlashSize=16M,PSRAM=opi,PartitionScheme=app3M_fat9M_16MB,USBMode=hwcdc,CDCOnBoot=cdc" # Headless render benchmark (any ESP32-S3 + PSRAM, no panel; not on the web flasher)
 )
 
 # Default board (used when only one board is configured)
 DEFAULT_BOARD=""
 
+# PNG asset compression for tools/png2lvgl_assets.py: none | rle | lz4 | auto
+# Compressed images are inflated on first draw into the firmware's decoded image
+# cache (LVGL_ASSET_CACHE_BYTES); see docs/scripts.md.
+PNG_ASSETS_COMPRESS="none"
+
 # ----------------------------------------------------------------------------
 # Optional project-specific overrides
 # ----------------------------------------------------------------------------
@@ -77,6 +83,7 @@ DEFAULT_BOARD=""
 # If present, this file is sourced AFTER defaults above, so it can override:
 #   - PROJECT_NAME / PROJECT_DISPLAY_NAME
 #   - DEFAULT_BOARD
+#   - PNG_ASSETS_COMPRESS
 #   - FQBN_TARGETS (redeclare the associative array)
 #
 # Recommended filename: config.project.sh (commit it in the project repo).
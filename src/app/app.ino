@@ -20,6 +20,10 @@
 #if HAS_DISPLAY
 #include "display_manager.h"
 #include "screen_saver_manager.h"
+#include "ui_state.h"
+#if DISPLAY_BENCHMARK_ENABLED
+#include "display_benchmark.h"
+#endif
 #endif
 
 #if HAS_TOUCH
@@ -292,6 +296,10 @@ void setup()
 	// Start the screen saver inactivity timer after the first runtime screen is visible.
 	// This avoids counting boot + splash time as "inactivity".
 	screen_saver_manager_notify_activity(false);
+
+	#if DISPLAY_BENCHMARK_ENABLED
+	display_benchmark_start();
+	#endif
 	#endif
 }
 
@@ -302,6 +310,7 @@ void loop()
 
 	#if HAS_DISPLAY
 	screen_saver_manager_loop();
+	ui_state_loop(&device_config);
 	#endif
 
 	#if HAS_TOUCH
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Decoders for compressed image assets emitted by tools/png2lvgl_assets.py
+// (--compress rle|lz4|auto). Used by lvgl_asset_decoder.cpp; header-only so
+// the converter's output can be round-trip checked on the host
+// (tests/asset_codec_test.cpp, against checked-in output in tests/assets/).
+//
+// Blob layout (little-endian), stored as the lv_image_dsc_t data of an image
+// flagged LV_IMAGE_FLAGS_USER1:
+//   0  'A' 'C'      magic
+//   2  method       ASSET_METHOD_RLE / ASSET_METHOD_LZ4
+//   3  unit0        RLE element size (bytes) for the first split bytes
+//   4  raw_size     decoded size (u32)
+//   8  split        bytes in part 0; the rest uses 1-byte elements (u32)
+//   12 payload
+//
+// RLE: control byte c, then
+//   c & 0x80 -> one element repeated (c & 0x7F) + 1 times
+//   else     -> c + 1 literal elements
+// Part 0 (the RGB565 plane of RGB565A8, unit0 = 2) and part 1 (the alpha
+// plane, unit 1) are two back-to-back RLE streams.
+//
+// LZ4: one standard LZ4 block (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+// over the whole image; split/unit0 are unused.
+//
+// All decoders are bounds-checked against both buffers and return false on
+// malformed input instead of reading or writing out of range.
+
+#define ASSET_BLOB_HEADER_SIZE 12
+#define ASSET_METHOD_RLE 1
+#define ASSET_METHOD_LZ4 2
+
+struct AssetBlobInfo {
+		uint8_t method;
+		uint8_t unit0;
+		uint32_t raw_size;
+		uint32_t split;
+		const uint8_t* payload;
+		size_t payload_len;
+};
+
+static inline uint32_t asset_read_u32(const uint8_t* p) {
+		return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline bool asset_blob_parse(const uint8_t* blob, size_t len, AssetBlobInfo* out) {
+		if (!blob || len < ASSET_BLOB_HEADER_SIZE) return false;
+		if (blob[0] != 'A' || blob[1] != 'C') return false;
+		out->method = blob[2];
+		out->unit0 = blob[3];
+		out->raw_size = asset_read_u32(blob + 4);
+		out->split = asset_read_u32(blob + 8);
+		out->payload = blob + ASSET_BLOB_HEADER_SIZE;
+		out->payload_len = len - ASSET_BLOB_HEADER_SIZE;
+		if (out->method != ASSET_METHOD_RLE && out->method != ASSET_METHOD_LZ4) return false;
+		if (out->method == ASSET_METHOD_RLE
+				&& (out->unit0 == 0 || out->split > out->raw_size || out->split % out->unit0)) return false;
+		return true;
+}
+
+// Decode one RLE stream of `unit`-byte elements until dst_len bytes are produced.
+// Returns the number of source bytes consumed, or 0 on malformed input.
+static inline size_t asset_rle_decode(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_len, uint8_t unit) {
+		size_t si = 0, di = 0;
+		while (di < dst_len) {
+				if (si >= src_len) return 0;
+				const uint8_t c = src[si++];
+				const size_t count = (size_t)(c & 0x7F) + 1;
+				const size_t bytes = count * unit;
+				if (bytes > dst_len - di) return 0;
+				if (c & 0x80) {
+						if (unit > src_len - si) return 0;
+						if (unit == 1) {
+								memset(dst + di, src[si], bytes);
+						} else {
+								for (size_t k = 0; k < count; k++) {
+										memcpy(dst + di + k * unit, src + si, unit);
+								}
+						}
+						si += unit;
+				} else {
+						if (bytes > src_len - si) return 0;
+						memcpy(dst + di, src + si, bytes);
+						si += bytes;
+				}
+				di += bytes;
+		}
+		return si;
+}
+
+// Decode one LZ4 block; true when exactly dst_len bytes were produced.
+static inline bool asset_lz4_decode(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_len) {
+		size_t si = 0, di = 0;
+		while (si < src_len) {
+				const uint8_t token = src[si++];
+
+				size_t lit = token >> 4;
+				if (lit == 15) {
+						uint8_t b;
+						do {
+								if (si >= src_len) return false;
+								b = src[si++];
+								lit += b;
+						} while (b == 255);
+				}
+				if (lit > src_len - si || lit > dst_len - di) return false;
+				memcpy(dst + di, src + si, lit);
+				si += lit;
+				di += lit;
+
+				if (si == src_len) break;  // Last sequence: literals only
+
+				if (src_len - si < 2) return false;
+				const size_t offset = (size_t)src[si] | ((size_t)src[si + 1] << 8);
+				si += 2;
+				if (offset == 0 || offset > di) return false;
+
+				size_t mlen = token & 0x0F;
+				if (mlen == 15) {
+						uint8_t b;
+						do {
+								if (si >= src_len) return false;
+								b = src[si++];
+								mlen += b;
+						} while (b == 255);
+				}
+				mlen += 4;
+				if (mlen > dst_len - di) return false;
+
+				const uint8_t* match = dst + di - offset;
+				if (offset >= mlen) {
+						memcpy(dst + di, match, mlen);
+				} else {
+						// Overlapping copy (repeating pattern): must go forward byte by byte.
+						for (size_t k = 0; k < mlen; k++) dst[di + k] = match[k];
+				}
+				di += mlen;
+		}
+		return di == dst_len;
+}
+
+// Decode a whole blob into dst (dst_len must equal raw_size).
+static inline bool asset_blob_decode(const AssetBlobInfo* info, uint8_t* dst, size_t dst_len) {
+		if (dst_len != info->raw_size) return false;
+		if (info->method == ASSET_METHOD_LZ4) {
+				return asset_lz4_decode(info->payload, info->payload_len, dst, dst_len);
+		}
+
+		const size_t used0 = info->split
+				? asset_rle_decode(info->payload, info->payload_len, dst, info->split, info->unit0)
+				: 0;
+		if (info->split && used0 == 0) return false;
+		const size_t rest = dst_len - info->split;
+		if (rest == 0) return used0 == info->payload_len;
+		const size_t used1 = asset_rle_decode(info->payload + used0, info->payload_len - used0, dst + info->split, rest, 1);
+		return used1 != 0 && used0 + used1 == info->payload_len;
+}
@@ -198,6 +198,26 @@
 #define HEALTH_HISTORY_SECONDS 300
 #endif
 
+// Serve /api/health/stream (Server-Sent Events).
+#ifndef HEALTH_STREAM_ENABLED
+#define HEALTH_STREAM_ENABLED 1
+#endif
+
+// Health stream push cadence (ms).
+#ifndef HEALTH_STREAM_INTERVAL_MS
+#define HEALTH_STREAM_INTERVAL_MS HEALTH_POLL_INTERVAL_MS
+#endif
+
+// Maximum concurrent /api/health/stream subscribers (more get HTTP 503).
+#ifndef HEALTH_STREAM_MAX_CLIENTS
+#define HEALTH_STREAM_MAX_CLIENTS 3
+#endif
+
+// Unsent frames a health stream client may have queued before it skips a tick.
+#ifndef HEALTH_STREAM_MAX_QUEUED
+#define HEALTH_STREAM_MAX_QUEUED 2
+#endif
+
 // ============================================================================
 // Optional: Device-side Health History (/api/health/history)
 // ============================================================================
@@ -263,6 +283,7 @@
 //   DISPLAY_DRIVER_ARDUINO_GFX_ST77916 (7) - Arduino_GFX ST77916 QSPI 360x360 (JC3636W518)
 //   DISPLAY_DRIVER_ST7703_DSI (8) - Direct ESP-IDF ST7703 MIPI-DSI (ESP32-P4-WIFI6-Touch-LCD-4B)
 //   DISPLAY_DRIVER_ST7701_DSI (9) - Direct ESP-IDF ST7701 MIPI-DSI (JC4880P433, ESP32-P4)
+//   DISPLAY_DRIVER_HEADLESS (10) - In-memory RGB565 framebuffer, no panel (render benchmarks)
 #define DISPLAY_DRIVER_TFT_ESPI 1
 #define DISPLAY_DRIVER_LOVYANGFX 3
 #define DISPLAY_DRIVER_ARDUINO_GFX 4
@@ -270,6 +291,7 @@
 #define DISPLAY_DRIVER_ARDUINO_GFX_ST77916 7
 #define DISPLAY_DRIVER_ST7703_DSI 8
 #define DISPLAY_DRIVER_ST7701_DSI 9
+#define DISPLAY_DRIVER_HEADLESS 10
 
 // Select the display HAL backend (one of the DISPLAY_DRIVER_* constants).
 #ifndef DISPLAY_DRIVER
@@ -372,6 +394,106 @@
 #define LVGL_TASK_PRIORITY 4
 #endif
 
+// Idle-aware render loop: park the LVGL task while nothing draws, animates or is pressed.
+#ifndef LVGL_IDLE_SCHEDULER
+#define LVGL_IDLE_SCHEDULER false
+#endif
+
+// Quiet time before the LVGL task enters the idle wait (ms).
+#ifndef LVGL_IDLE_ENTER_MS
+#define LVGL_IDLE_ENTER_MS 500
+#endif
+
+// Idle wait timeout: input and Screen::update() are still sampled at this period (ms).
+#ifndef LVGL_IDLE_POLL_MS
+#define LVGL_IDLE_POLL_MS 100
+#endif
+
+// Buffered drivers: send each dirty row band at its own offset (panel must honour the address window).
+#ifndef DISPLAY_PARTIAL_PRESENT
+#define DISPLAY_PARTIAL_PRESENT false
+#endif
+
+// Buffered drivers: second framebuffer so present() never reads rows LVGL is rewriting (tear-free).
+#ifndef DISPLAY_DOUBLE_BUFFER
+#define DISPLAY_DOUBLE_BUFFER false
+#endif
+
+// Buffered drivers: skip rows whose content is unchanged since they were last sent.
+#ifndef DISPLAY_ROW_HASH
+#define DISPLAY_ROW_HASH false
+#endif
+
+// Direct (synchronous) drivers: send vertically adjacent LVGL flush areas as one bus transaction.
+#ifndef DISPLAY_FLUSH_COALESCE
+#define DISPLAY_FLUSH_COALESCE false
+#endif
+
+// Coalescing staging buffer size in pixels (internal RAM preferred).
+#ifndef DISPLAY_FLUSH_COALESCE_PIXELS
+#define DISPLAY_FLUSH_COALESCE_PIXELS (LVGL_BUFFER_SIZE * 2)
+#endif
+
+// Coalescing: only areas up to this many pixels are staged; larger ones are sent from px_map.
+#ifndef DISPLAY_FLUSH_COALESCE_MAX_AREA_PX
+#define DISPLAY_FLUSH_COALESCE_MAX_AREA_PX 1024
+#endif
+
+// TFT_eSPI driver: send flush strips by SPI DMA while LVGL renders the next one.
+#ifndef TFT_ESPI_DMA_FLUSH
+#define TFT_ESPI_DMA_FLUSH false
+#endif
+
+// LVGL draw buffers (2 = LVGL renders into one while the other is sent).
+#ifndef LVGL_DRAW_BUF_COUNT
+#define LVGL_DRAW_BUF_COUNT (TFT_ESPI_DMA_FLUSH ? 2 : 1)
+#endif
+
+// Window for the lv_timer/flush/present duration percentiles in /api/health and MQTT (ms).
+#ifndef DISPLAY_PERF_HIST_WINDOW_MS
+#define DISPLAY_PERF_HIST_WINDOW_MS 10000
+#endif
+
+// Drop a touch latency sample when no frame is flushed within this time (ms).
+#ifndef DISPLAY_INPUT_LATENCY_MAX_MS
+#define DISPLAY_INPUT_LATENCY_MAX_MS 500
+#endif
+
+// LVGL heap budget for resident screens in PSRAM (bytes, 0 = no limit).
+#ifndef DISPLAY_SCREEN_BUDGET_PSRAM
+#define DISPLAY_SCREEN_BUDGET_PSRAM 0
+#endif
+
+// LVGL heap budget for resident screens in internal RAM (bytes, 0 = no limit).
+#ifndef DISPLAY_SCREEN_BUDGET_INTERNAL
+#define DISPLAY_SCREEN_BUDGET_INTERNAL 0
+#endif
+
+// Most registered screens kept created at once, LRU-evicted (0 = no limit).
+#ifndef DISPLAY_SCREEN_MAX_RESIDENT
+#define DISPLAY_SCREEN_MAX_RESIDENT 0
+#endif
+
+// Pre-create the predicted next screen in an idle LVGL pass after every switch.
+#ifndef DISPLAY_SCREEN_PREWARM
+#define DISPLAY_SCREEN_PREWARM false
+#endif
+
+// Decoded image cache budget for compressed PNG assets, PSRAM preferred (bytes).
+#ifndef LVGL_ASSET_CACHE_BYTES
+#define LVGL_ASSET_CACHE_BYTES (256 * 1024)
+#endif
+
+// Run the on-device display frame benchmark after boot (see display_benchmark.h).
+#ifndef DISPLAY_BENCHMARK_ENABLED
+#define DISPLAY_BENCHMARK_ENABLED false
+#endif
+
+// Measurement window per benchmarked screen (ms).
+#ifndef DISPLAY_BENCHMARK_SCREEN_MS
+#define DISPLAY_BENCHMARK_SCREEN_MS 5000
+#endif
+
 // ============================================================================
 // Backlight Configuration
 // ============================================================================
@@ -406,6 +528,36 @@
 #define TFT_BACKLIGHT_DUTY_MAX 255
 #endif
 
+// Hand backlight fades to the driver's timer-driven fade engine (PWM backlights).
+#ifndef BACKLIGHT_FADE_ENGINE
+#define BACKLIGHT_FADE_ENGINE false
+#endif
+
+// Fade curve gamma: perceived lightness changes linearly in time (1.0 = linear duty).
+#ifndef BACKLIGHT_FADE_GAMMA
+#define BACKLIGHT_FADE_GAMMA 2.2f
+#endif
+
+// Fade engine duty update period (ms).
+#ifndef BACKLIGHT_FADE_TICK_MS
+#define BACKLIGHT_FADE_TICK_MS 5
+#endif
+
+// Suspend LVGL rendering while the screen saver is asleep.
+#ifndef DISPLAY_SLEEP_RENDER_OFF
+#define DISPLAY_SLEEP_RENDER_OFF false
+#endif
+
+// With DISPLAY_SLEEP_RENDER_OFF, also put the panel controller into sleep-in.
+#ifndef DISPLAY_SLEEP_PANEL
+#define DISPLAY_SLEEP_PANEL false
+#endif
+
+// Board current saved while rendering is off, in mA (0 = unknown).
+#ifndef DISPLAY_SLEEP_SAVED_MA
+#define DISPLAY_SLEEP_SAVED_MA 0
+#endif
+
 // ============================================================================
 // Touch Configuration
 // ============================================================================
@@ -439,6 +591,31 @@
 #define TOUCH_I2C_BUS 1
 #endif
 
+// Sample touch from the INT pin instead of on every LVGL indev poll.
+#ifndef TOUCH_INT_SAMPLING
+#define TOUCH_INT_SAMPLING false
+#endif
+
+// Sampler poll period while a touch is held (ms).
+#ifndef TOUCH_INT_PRESSED_POLL_MS
+#define TOUCH_INT_PRESSED_POLL_MS 16
+#endif
+
+// Smooth touch points before LVGL sees them.
+#ifndef TOUCH_FILTER
+#define TOUCH_FILTER false
+#endif
+
+// Recognize touch gestures in TouchManager.
+#ifndef TOUCH_GESTURES
+#define TOUCH_GESTURES false
+#endif
+
+// Number of LVGL software draw units (1 = render inline in the LVGL task).
+#ifndef LVGL_DRAW_SW_UNITS
+#define LVGL_DRAW_SW_UNITS 1
+#endif
+
 // Prefer allocating LVGL draw buffer in internal RAM before PSRAM.
 // Default: false (keeps historical PSRAM-first behavior; boards can override).
 // Prefer internal RAM over PSRAM for LVGL draw buffer allocation.
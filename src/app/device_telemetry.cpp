@@ -3,6 +3,7 @@
 #include "log_manager.h"
 #include "board_config.h"
 #include "fs_health.h"
+#include "perf_histogram.h"
 #include "rtos_task_utils.h"
 #include "sensors/sensor_manager.h"
 
@@ -21,6 +22,11 @@
 
 #if HAS_DISPLAY
 #include "display_manager.h"
+#include "lvgl_asset_decoder.h"
+#endif
+
+#if HAS_TOUCH
+#include "touch_manager.h"
 #endif
 
 // Temperature sensor support (ESP32-C3, ESP32-S2, ESP32-S3, ESP32-C2, ESP32-C6, ESP32-H2)
@@ -170,6 +176,35 @@ static void fill_common(JsonDocument &doc, bool include_ip_and_channel, bool inc
 
 static void fill_health_window_fields(JsonDocument &doc);
 
+// Display duration percentiles: one key set per metric (literal keys, no copies).
+struct DisplayPctKeys {
+		const char* p50;
+		const char* p95;
+		const char* p99;
+		const char* max;
+};
+
+static const DisplayPctKeys kLvTimerPctKeys = {"display_lv_timer_p50_us", "display_lv_timer_p95_us", "display_lv_timer_p99_us", "display_lv_timer_max_us"};
+static const DisplayPctKeys kFlushPctKeys = {"display_flush_p50_us", "display_flush_p95_us", "display_flush_p99_us", "display_flush_max_us"};
+static const DisplayPctKeys kPresentPctKeys = {"display_present_p50_us", "display_present_p95_us", "display_present_p99_us", "display_present_max_us"};
+static const DisplayPctKeys kTouchFlushPctKeys = {"touch_flush_p50_us", "touch_flush_p95_us", "touch_flush_p99_us", "touch_flush_max_us"};
+static const DisplayPctKeys kTouchPresentPctKeys = {"touch_present_p50_us", "touch_present_p95_us", "touch_present_p99_us", "touch_present_max_us"};
+
+// Writes null for all four keys when p is null or has no samples.
+static void put_display_percentiles(JsonDocument &doc, const DisplayPctKeys &keys, const PerfPercentiles* p) {
+		if (p && p->count > 0) {
+				doc[keys.p50] = p->p50_us;
+				doc[keys.p95] = p->p95_us;
+				doc[keys.p99] = p->p99_us;
+				doc[keys.max] = p->max_us;
+		} else {
+				doc[keys.p50] = nullptr;
+				doc[keys.p95] = nullptr;
+				doc[keys.p99] = nullptr;
+				doc[keys.max] = nullptr;
+		}
+}
+
 struct HealthWindowComputed {
 		uint32_t heap_internal_free_min_window;
 		uint32_t heap_internal_free_max_window;
@@ -993,26 +1028,128 @@ static void fill_common(JsonDocument &doc, bool include_ip_and_channel, bool inc
 
 		// Display perf (best-effort)
 		#if HAS_DISPLAY
-		if (displayManager) {
-				DisplayPerfStats stats;
-				if (display_manager_get_perf_stats(&stats)) {
-						doc["display_fps"] = stats.fps;
-						doc["display_lv_timer_us"] = stats.lv_timer_us;
-						doc["display_present_us"] = stats.present_us;
-				} else {
-						doc["display_fps"] = nullptr;
-						doc["display_lv_timer_us"] = nullptr;
-						doc["display_present_us"] = nullptr;
+		DisplayPerfStats stats;
+		if (displayManager && display_manager_get_perf_stats(&stats)) {
+				doc["display_fps"] = stats.fps;
+				doc["display_lv_timer_us"] = stats.lv_timer_us;
+				doc["display_present_us"] = stats.present_us;
+				doc["display_bytes_per_frame"] = stats.bytes_per_frame;
+				if (include_debug_fields) {
+						doc["display_flush_areas"] = stats.flush_areas;
+						doc["display_flush_transactions"] = stats.flush_transactions;
+						doc["display_flush_staged"] = stats.flush_staged;
+						doc["display_flush_merged"] = stats.flush_merged;
+						doc["display_rows_hashed"] = stats.rows_hashed;
+						doc["display_rows_skipped"] = stats.rows_skipped;
+						doc["display_row_hash_us"] = stats.row_hash_us;
+						doc["display_switch_us"] = stats.switch_us;
+						doc["display_switch_warm"] = stats.switch_warm;
 				}
+				put_display_percentiles(doc, kLvTimerPctKeys, &stats.lv_timer_pct);
+				put_display_percentiles(doc, kFlushPctKeys, &stats.flush_pct);
+				put_display_percentiles(doc, kPresentPctKeys, &stats.present_pct);
+				doc["display_lvgl_busy_pct"] = stats.lvgl_busy_pct;
+				doc["display_lvgl_idle_pct"] = stats.lvgl_idle_pct;
 		} else {
 				doc["display_fps"] = nullptr;
 				doc["display_lv_timer_us"] = nullptr;
 				doc["display_present_us"] = nullptr;
+				doc["display_bytes_per_frame"] = nullptr;
+				put_display_percentiles(doc, kLvTimerPctKeys, nullptr);
+				put_display_percentiles(doc, kFlushPctKeys, nullptr);
+				put_display_percentiles(doc, kPresentPctKeys, nullptr);
+				doc["display_lvgl_busy_pct"] = nullptr;
+				doc["display_lvgl_idle_pct"] = nullptr;
+		}
+
+		// Screen residency (lazy create + DISPLAY_SCREEN_BUDGET_* eviction)
+		DisplayScreenStats screenStats;
+		if (include_debug_fields && displayManager && display_manager_get_screen_stats(&screenStats)) {
+				doc["display_screens_resident"] = screenStats.resident;
+				doc["display_screens_psram_bytes"] = screenStats.psram_bytes;
+				doc["display_screens_internal_bytes"] = screenStats.internal_bytes;
+				doc["display_screen_creates"] = screenStats.creates;
+				doc["display_screen_evictions"] = screenStats.evictions;
+				doc["display_screen_prewarms"] = screenStats.prewarms;
+		}
+
+		// Compressed image assets (decoded image cache)
+		LvglAssetCacheStats imgStats;
+		if (include_debug_fields && lvgl_asset_decoder_get_stats(&imgStats)) {
+				const uint32_t lookups = imgStats.hits + imgStats.misses;
+				doc["display_img_cache_hits"] = imgStats.hits;
+				doc["display_img_cache_misses"] = imgStats.misses;
+				doc["display_img_cache_hit_pct"] = lookups ? (uint32_t)((uint64_t)imgStats.hits * 100 / lookups) : 0;
+				doc["display_img_cache_evictions"] = imgStats.evictions;
+				doc["display_img_cache_oversize"] = imgStats.oversize;
+				doc["display_img_cache_pinned_full"] = imgStats.pinned_full;
+				doc["display_img_cache_errors"] = imgStats.errors;
+				doc["display_img_cache_entries"] = imgStats.entries;
+				doc["display_img_cache_bytes"] = imgStats.bytes;
+				doc["display_img_decode_us_avg"] = imgStats.decode_us_avg;
+				doc["display_img_decode_us_max"] = imgStats.decode_us_max;
 		}
+
+		// Async DMA flush (TFT_ESPI_DMA_FLUSH): how much panel transfer overlapped rendering
+		DisplayFlushDmaStats dmaStats;
+		if (include_debug_fields && display_manager_get_flush_dma_stats(&dmaStats)) {
+				doc["display_dma_transfers"] = dmaStats.transfers;
+				doc["display_dma_waits"] = dmaStats.waits;
+				doc["display_dma_overlap_pct"] = dmaStats.overlap_pct;
+				doc["display_dma_stall_ms"] = dmaStats.stall_ms;
+		}
+
+		#if DISPLAY_SLEEP_RENDER_OFF
+		// Render-off while the screen saver is asleep (skipped work is estimated from awake averages)
+		DisplaySleepStats sleepStats;
+		if (include_debug_fields && display_manager_get_sleep_stats(&sleepStats)) {
+				doc["display_sleep_asleep"] = sleepStats.asleep;
+				doc["display_sleep_panel"] = sleepStats.panel_sleep;
+				doc["display_sleep_count"] = sleepStats.sleeps;
+				doc["display_sleep_ms"] = sleepStats.asleep_ms;
+				doc["display_sleep_cpu_saved_ms"] = sleepStats.cpu_saved_ms;
+				doc["display_sleep_frames_skipped"] = sleepStats.frames_skipped;
+				doc["display_sleep_kb_skipped"] = sleepStats.kb_skipped;
+				if (DISPLAY_SLEEP_SAVED_MA > 0) {
+						doc["display_sleep_saved_mah"] = sleepStats.saved_mah;
+				}
+		}
+		#endif
 		#else
 		doc["display_fps"] = nullptr;
 		doc["display_lv_timer_us"] = nullptr;
 		doc["display_present_us"] = nullptr;
+		doc["display_bytes_per_frame"] = nullptr;
+		put_display_percentiles(doc, kLvTimerPctKeys, nullptr);
+		put_display_percentiles(doc, kFlushPctKeys, nullptr);
+		put_display_percentiles(doc, kPresentPctKeys, nullptr);
+		doc["display_lvgl_busy_pct"] = nullptr;
+		doc["display_lvgl_idle_pct"] = nullptr;
+		#endif
+
+		#if HAS_TOUCH && HAS_DISPLAY
+		// Touch-to-photon latency since boot (TouchTestScreen resets it when shown).
+		// /api/health only: too large for the retained MQTT health payload.
+		DisplayInputLatency latency;
+		if (include_debug_fields && display_manager_get_input_latency(&latency)) {
+				put_display_percentiles(doc, kTouchFlushPctKeys, &latency.touch_flush);
+				put_display_percentiles(doc, kTouchPresentPctKeys, &latency.touch_present);
+				doc["touch_latency_presses"] = latency.presses;
+				doc["touch_latency_unmatched"] = latency.unmatched;
+		}
+		#endif
+
+		#if HAS_TOUCH
+		// Touch sampling (TOUCH_INT_SAMPLING): I2C reads avoided by the cached point
+		TouchSamplerStats touchStats;
+		if (include_debug_fields && touch_manager_get_sampler_stats(&touchStats)) {
+				doc["touch_int_sampling"] = touchStats.active;
+				doc["touch_irqs"] = touchStats.interrupts;
+				doc["touch_i2c_reads"] = touchStats.i2c_reads;
+				doc["touch_cache_reads"] = touchStats.cache_reads;
+				doc["touch_i2c_reads_saved"] = touchStats.reads_saved;
+				doc["touch_gestures"] = touch_manager_gesture_count();
+		}
 		#endif
 
 		// WiFi stats (only if connected)
@@ -0,0 +1,259 @@
+#include "board_config.h"
+
+#if HAS_DISPLAY
+
+#include "display_benchmark.h"
+#include "display_manager.h"
+#include "screen_saver_manager.h"
+#include "log_manager.h"
+#include "rtos_task_utils.h"
+#include "drivers/rgb565_rotate.h"
+#include "drivers/rgb565_copy.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "soc/soc_caps.h"
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+namespace {
+// Time to let a freshly shown screen settle (first full-screen redraw,
+// style/font caches) before the measurement window opens.
+static const uint32_t kWarmupMs = 500;
+
+static const char* const kScreens[] = { "info", "test", "fps", "fps_complex" };
+
+static TaskHandle_t g_task = nullptr;
+static RtosTaskPsramAlloc g_task_alloc = {};
+
+static uint32_t avg_u32(uint64_t sum, uint32_t count) {
+		return count ? (uint32_t)(sum / count) : 0;
+}
+
+static void log_result(const char* screen_id, const DisplayBenchStats& s, const DisplayPerfStats& perf) {
+		const float fps = s.window_ms ? (s.frames * 1000.0f / (float)s.window_ms) : 0.0f;
+
+		// One line per screen, key=value so logs can be scraped/diffed across builds.
+		LOGI("Bench", "screen=%s draw_units=%d window_ms=%lu frames=%lu fps=%.1f flushes=%lu transactions=%lu px_flush_avg=%lu px_flush_min=%lu px_flush_max=%lu lv_timer_us_avg=%lu lv_timer_us_min=%lu lv_timer_us_p50=%lu lv_timer_us_p95=%lu lv_timer_us_p99=%lu lv_timer_us_max=%lu presents=%lu present_us_avg=%lu present_us_min=%lu present_us_p50=%lu present_us_p95=%lu present_us_p99=%lu present_us_max=%lu switch_us=%lu switch=%s",
+				screen_id,
+				(int)LV_DRAW_SW_DRAW_UNIT_CNT,
+				(unsigned long)s.window_ms,
+				(unsigned long)s.frames,
+				fps,
+				(unsigned long)s.flushes,
+				(unsigned long)s.transactions,
+				(unsigned long)avg_u32(s.flush_pixels, s.flushes),
+				(unsigned long)s.flush_pixels_min,
+				(unsigned long)s.flush_pixels_max,
+				(unsigned long)avg_u32(s.lv_timer_us_sum, s.frames),
+				(unsigned long)s.lv_timer_us_min,
+				(unsigned long)s.lv_timer_pct.p50_us,
+				(unsigned long)s.lv_timer_pct.p95_us,
+				(unsigned long)s.lv_timer_pct.p99_us,
+				(unsigned long)s.lv_timer_us_max,
+				(unsigned long)s.presents,
+				(unsigned long)avg_u32(s.present_us_sum, s.presents),
+				(unsigned long)s.present_us_min,
+				(unsigned long)s.present_pct.p50_us,
+				(unsigned long)s.present_pct.p95_us,
+				(unsigned long)s.present_pct.p99_us,
+				(unsigned long)s.present_us_max,
+				(unsigned long)perf.switch_us,
+				perf.switch_warm ? "warm" : "cold");
+}
+
+// Full frames copied per rotation/implementation in the kernel benchmark.
+static const uint32_t kKernelFrames = 10;
+
+static void* alloc_prefer_psram(size_t bytes) {
+		void* p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		if (!p) p = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		return p;
+}
+
+// Copy kKernelFrames full frames, strip by strip (LVGL_BUFFER_SIZE pixels each),
+// through one rotation kernel and return the elapsed time in microseconds.
+typedef void (*RotateBlitFn)(uint16_t*, uint16_t, uint16_t, const uint16_t*, uint32_t, int16_t, int16_t, uint16_t, uint16_t, uint8_t);
+
+static int64_t time_rotate_kernel(RotateBlitFn fn, uint16_t* fb, const uint16_t* strip, uint8_t rotation) {
+		const uint16_t logicalW = (rotation & 1) ? DISPLAY_HEIGHT : DISPLAY_WIDTH;
+		const uint16_t logicalH = (rotation & 1) ? DISPLAY_WIDTH : DISPLAY_HEIGHT;
+		uint16_t stripRows = (uint16_t)(LVGL_BUFFER_SIZE / logicalW);
+		if (stripRows == 0) stripRows = 1;
+
+		const int64_t start = esp_timer_get_time();
+		for (uint32_t f = 0; f < kKernelFrames; f++) {
+				for (uint16_t y = 0; y < logicalH; y += stripRows) {
+						const uint16_t h = (uint16_t)((logicalH - y) < stripRows ? (logicalH - y) : stripRows);
+						fn(fb, DISPLAY_WIDTH, DISPLAY_HEIGHT, strip, logicalW, 0, (int16_t)y, logicalW, h, rotation);
+				}
+		}
+		return esp_timer_get_time() - start;
+}
+
+// Compare the tiled rotation kernel against the scalar reference for every
+// rotation: MB/s for each, plus a framebuffer compare to catch mapping bugs.
+static void run_rotate_kernel_bench() {
+		const size_t fbBytes = (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(uint16_t);
+		const size_t stripBytes = (size_t)LVGL_BUFFER_SIZE * sizeof(uint16_t);
+
+		// Strip mirrors the LVGL draw buffer placement; framebuffers mirror the driver (PSRAM).
+		uint16_t* strip = (uint16_t*)(LVGL_BUFFER_PREFER_INTERNAL
+				? heap_caps_malloc(stripBytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+				: alloc_prefer_psram(stripBytes));
+		uint16_t* fbTiled = (uint16_t*)alloc_prefer_psram(fbBytes);
+		uint16_t* fbScalar = (uint16_t*)alloc_prefer_psram(fbBytes);
+
+		if (!strip || !fbTiled || !fbScalar) {
+				LOGW("Bench", "Rotation kernel benchmark skipped (alloc failed)");
+		} else {
+				for (uint32_t i = 0; i < LVGL_BUFFER_SIZE; i++) {
+						strip[i] = (uint16_t)(i * 2654435761u >> 16);
+				}
+
+				for (uint8_t rot = 0; rot < 4; rot++) {
+						memset(fbTiled, 0, fbBytes);
+						memset(fbScalar, 0, fbBytes);
+						const int64_t scalarUs = time_rotate_kernel(rgb565_rotate_blit_scalar, fbScalar, strip, rot);
+						const int64_t tiledUs = time_rotate_kernel(rgb565_rotate_blit, fbTiled, strip, rot);
+						const bool match = memcmp(fbTiled, fbScalar, fbBytes) == 0;
+
+						// bytes / us == MB/s
+						const float mb = (float)fbBytes * kKernelFrames;
+						LOGI("Bench", "kernel=rotate rot=%u scalar_mbps=%.1f tiled_mbps=%.1f speedup=%.2f match=%s",
+								(unsigned)rot,
+								scalarUs > 0 ? mb / (float)scalarUs : 0.0f,
+								tiledUs > 0 ? mb / (float)tiledUs : 0.0f,
+								tiledUs > 0 ? (float)scalarUs / (float)tiledUs : 0.0f,
+								match ? "yes" : "NO");
+				}
+		}
+
+		if (strip) heap_caps_free(strip);
+		if (fbTiled) heap_caps_free(fbTiled);
+		if (fbScalar) heap_caps_free(fbScalar);
+}
+
+// Byte-swap one LVGL strip's worth of pixels into a framebuffer-sized
+// destination, kKernelFrames times over, and return the elapsed microseconds.
+typedef void (*SwapCopyFn)(uint16_t*, const uint16_t*, uint32_t);
+
+static int64_t time_swap_kernel(SwapCopyFn fn, uint16_t* dst, const uint16_t* src, uint32_t rowPx, uint32_t rows, uint32_t dstOffsetPx) {
+		const int64_t start = esp_timer_get_time();
+		for (uint32_t f = 0; f < kKernelFrames; f++) {
+				for (uint32_t r = 0; r < rows; r++) {
+						fn(dst + (size_t)r * DISPLAY_WIDTH + dstOffsetPx, src, rowPx);
+				}
+		}
+		return esp_timer_get_time() - start;
+}
+
+// Compare the word-at-a-time swap kernel against the per-pixel reference.
+// Runs an aligned full-width case and an odd-width, 2-byte-misaligned case
+// (LVGL areas at odd x), with a destination compare for each.
+static void run_swap_kernel_bench() {
+		const size_t fbBytes = (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(uint16_t);
+		uint16_t* src = (uint16_t*)(LVGL_BUFFER_PREFER_INTERNAL
+				? heap_caps_malloc(DISPLAY_WIDTH * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+				: alloc_prefer_psram(DISPLAY_WIDTH * sizeof(uint16_t)));
+		uint16_t* dstWord = (uint16_t*)alloc_prefer_psram(fbBytes);
+		uint16_t* dstScalar = (uint16_t*)alloc_prefer_psram(fbBytes);
+
+		if (!src || !dstWord || !dstScalar) {
+				LOGW("Bench", "Swap kernel benchmark skipped (alloc failed)");
+		} else {
+				for (uint32_t i = 0; i < DISPLAY_WIDTH; i++) {
+						src[i] = (uint16_t)(i * 2654435761u >> 16);
+				}
+
+				struct Case { const char* name; uint32_t rowPx; uint32_t dstOffsetPx; };
+				const Case cases[] = {
+						{ "aligned", DISPLAY_WIDTH, 0 },
+						{ "odd", (uint32_t)(DISPLAY_WIDTH - 3), 1 },
+				};
+
+				for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+						memset(dstWord, 0, fbBytes);
+						memset(dstScalar, 0, fbBytes);
+						const int64_t scalarUs = time_swap_kernel(rgb565_swap_copy_scalar, dstScalar, src, cases[c].rowPx, DISPLAY_HEIGHT, cases[c].dstOffsetPx);
+						const int64_t wordUs = time_swap_kernel(rgb565_swap_copy, dstWord, src, cases[c].rowPx, DISPLAY_HEIGHT, cases[c].dstOffsetPx);
+						const bool match = memcmp(dstWord, dstScalar, fbBytes) == 0;
+
+						const float mb = (float)cases[c].rowPx * DISPLAY_HEIGHT * sizeof(uint16_t) * kKernelFrames;
+						LOGI("Bench", "kernel=swap case=%s scalar_mbps=%.1f word_mbps=%.1f speedup=%.2f match=%s",
+								cases[c].name,
+								scalarUs > 0 ? mb / (float)scalarUs : 0.0f,
+								wordUs > 0 ? mb / (float)wordUs : 0.0f,
+								wordUs > 0 ? (float)scalarUs / (float)wordUs : 0.0f,
+								match ? "yes" : "NO");
+				}
+		}
+
+		if (src) heap_caps_free(src);
+		if (dstWord) heap_caps_free(dstWord);
+		if (dstScalar) heap_caps_free(dstScalar);
+}
+
+static void benchmark_task(void* param) {
+		(void)param;
+
+		run_rotate_kernel_bench();
+		run_swap_kernel_bench();
+
+		LOGI("Bench", "Starting display benchmark (%u ms per screen)", (unsigned)DISPLAY_BENCHMARK_SCREEN_MS);
+
+		for (size_t i = 0; i < sizeof(kScreens) / sizeof(kScreens[0]); i++) {
+				const char* id = kScreens[i];
+
+				bool ok = false;
+				display_manager_show_screen(id, &ok);
+				if (!ok) {
+						LOGW("Bench", "Screen '%s' not available, skipping", id);
+						continue;
+				}
+
+				// Keep the screen saver from dimming/sleeping mid-run.
+				screen_saver_manager_notify_activity(false);
+				vTaskDelay(pdMS_TO_TICKS(kWarmupMs));
+
+				display_manager_bench_begin();
+				vTaskDelay(pdMS_TO_TICKS(DISPLAY_BENCHMARK_SCREEN_MS));
+
+				DisplayBenchStats stats = {};
+				if (display_manager_bench_end(&stats)) {
+						// Switch → first present of this screen (recorded during warm-up).
+						DisplayPerfStats perf = {};
+						display_manager_get_perf_stats(&perf);
+						log_result(id, stats, perf);
+				}
+		}
+
+		LOGI("Bench", "Display benchmark complete");
+		display_manager_show_info();
+		screen_saver_manager_notify_activity(false);
+
+		g_task = nullptr;
+		vTaskDelete(nullptr);
+}
+} // namespace
+
+void display_benchmark_start() {
+		if (g_task != nullptr) return;  // Already running
+
+#if SOC_SPIRAM_SUPPORTED
+		if (heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0) {
+				if (rtos_create_task_psram_stack(benchmark_task, "DispBench", 3072, nullptr, 1, &g_task, &g_task_alloc)) {
+						return;
+				}
+				LOGW("Bench", "PSRAM-backed task creation failed, falling back to internal RAM");
+		}
+#endif
+
+		if (xTaskCreate(benchmark_task, "DispBench", 3072, nullptr, 1, &g_task) != pdPASS) {
+				g_task = nullptr;
+				LOGE("Bench", "Failed to create benchmark task");
+		}
+}
+
+#endif // HAS_DISPLAY
@@ -0,0 +1,27 @@
+#ifndef DISPLAY_BENCHMARK_H
+#define DISPLAY_BENCHMARK_H
+
+// On-device display frame benchmark.
+//
+// Runs once after boot:
+//   1. Rotation kernel throughput: tiled vs scalar rgb565_rotate_blit for
+//      rotations 0-3 (MB/s + output compare), one "Bench" line per rotation.
+//      Then word vs scalar rgb565_swap_copy, aligned and odd-width/misaligned.
+//   2. Cycles the built-in screens (info, test, fps, fps_complex) and logs
+//      one "Bench" line per screen with fps, per-flush pixel counts and
+//      lv_timer_handler()/present() timings (min/avg/p50/p95/p99/max)
+//      collected by DisplayManager.
+//      Each line carries draw_units=N, so the LVGL_DRAW_SW_UNITS speed-up is
+//      lv_timer_us_avg of fps_complex in a 1-unit build / a 2-unit build.
+//
+// Pair with DISPLAY_DRIVER_HEADLESS to benchmark the render path on a
+// bare ESP32-S3 + PSRAM dev board (esp32s3-headless), or enable on a real
+// board to include panel transfer cost. tests/frame_bench.cpp runs step 2
+// on Linux with the same screens and driver and prints the same line.
+// Enabled with DISPLAY_BENCHMARK_ENABLED (see board_config.h).
+
+// Starts the benchmark in a background task (no-op if already running).
+// Call after the display manager is initialized.
+void display_benchmark_start();
+
+#endif // DISPLAY_BENCHMARK_H
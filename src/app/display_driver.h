@@ -69,6 +69,14 @@ public:
 		virtual void setBacklightBrightness(uint8_t brightness) = 0;  // 0-100
 		virtual uint8_t getBacklightBrightness() = 0;
 		virtual bool hasBacklightControl() = 0;  // Capability query
+
+		// Play a whole backlight fade (from -> to, percent) without further calls,
+		// e.g. from a timer (BACKLIGHT_FADE_ENGINE). Returns false when unsupported;
+		// the caller then steps setBacklightBrightness() itself. Any later
+		// setBacklightBrightness() cancels a running fade.
+		virtual bool fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) { return false; }
+		// True while a fadeBacklight() ramp is still running.
+		virtual bool backlightFading() const { return false; }
 		
 		// Display-specific fixes/configuration (optional, board-dependent)
 		virtual void applyDisplayFixes() = 0;
@@ -96,6 +104,28 @@ public:
 				// Override in buffered drivers (e.g., Arduino_GFX canvas)
 		}
 
+		// Called from the LVGL task (LVGL mutex held) when a rendered frame is
+		// ready for present().  Double-buffered drivers swap back/front here and
+		// copy the dirty bands forward; returning false defers the hand-off
+		// (front buffer still being sent) and DisplayManager retries shortly.
+		// Default: single buffer, always ready.
+		virtual bool commitFrame() { return true; }
+
+		// Bytes sent to the panel by the most recent present() (perf telemetry).
+		// Only meaningful for Buffered drivers; Direct drivers transfer in
+		// pushColors() and DisplayManager counts those bytes itself.
+		virtual uint32_t lastPresentBytes() const { return 0; }
+
+		// Row-hash results of the most recent present() (DISPLAY_ROW_HASH,
+		// Buffered drivers): dirty rows hashed, rows dropped because their
+		// content was unchanged, and time spent hashing.
+		struct RowHashStats {
+				uint32_t rows_hashed;
+				uint32_t rows_skipped;
+				uint32_t hash_us;
+		};
+		virtual RowHashStats lastPresentRowHash() const { return RowHashStats{0, 0, 0}; }
+
 		// LVGL configuration hook (override to customize LVGL display settings)
 		// Called during LVGL initialization to allow driver-specific configuration
 		// such as software rotation, full refresh mode, etc.
@@ -105,10 +135,28 @@ public:
 				// Override if driver needs software rotation or other LVGL tweaks
 		}
 
+		// Panel controller sleep-in / sleep-out while rendering is suspended
+		// (DISPLAY_SLEEP_PANEL). Called from the LVGL task with no frame in
+		// flight; DisplayManager redraws the whole screen after sleep-out.
+		// Returns false when the panel has no sleep mode. MIPI DCS panels use
+		// DISPOFF + SLPIN / SLPOUT + DISPON (Arduino_GFX displayOff()/displayOn()).
+		virtual bool setPanelSleep(bool sleep) { return false; }
+
 		// Whether the driver signals flush-ready asynchronously (e.g., via DMA
 		// completion callback). When true, DisplayManager skips calling
 		// lv_display_flush_ready() in the flush callback.
 		virtual bool asyncFlush() const { return false; }
+
+		// Drivers that queue a flush on DMA and return before it is sent:
+		// wire_us is the transfer time, stall_us the part of it the LVGL task
+		// spent blocked waiting for a buffer (overlap = 1 - stall / wire).
+		struct FlushDmaStats {
+				uint32_t transfers;
+				uint32_t waits;     // Transfers still running when LVGL needed the buffer back
+				uint64_t wire_us;
+				uint64_t stall_us;
+		};
+		virtual bool flushDmaStats(FlushDmaStats* out) { return false; }
 };
 
 #endif // DISPLAY_DRIVER_H
@@ -20,6 +20,8 @@
 #elif DISPLAY_DRIVER == DISPLAY_DRIVER_ST7701_DSI
 #include "drivers/mipi_dsi_driver.cpp"
 #include "drivers/st7701_dsi_driver.cpp"
+#elif DISPLAY_DRIVER == DISPLAY_DRIVER_HEADLESS
+#include "drivers/headless_driver.cpp"
 #else
 #error "No display driver selected or unknown driver type"
 #endif
@@ -5,9 +5,17 @@
 #include "display_manager.h"
 #include "log_manager.h"
 #include "rtos_task_utils.h"
+#include "drivers/rgb565_copy.h"
+#include "lvgl_heap.h"
+#include "lvgl_asset_decoder.h"
 
 #include <esp_timer.h>
 
+#if LVGL_IDLE_SCHEDULER
+#include <display/lv_display_private.h>  // inv_p (pending invalidations)
+#include <misc/lv_timer_private.h>       // period / last_run / paused
+#endif
+
 // Include selected display driver header.
 // Driver implementations are compiled via src/app/display_drivers.cpp.
 #if DISPLAY_DRIVER == DISPLAY_DRIVER_TFT_ESPI
@@ -22,6 +30,8 @@
 #include "drivers/st7703_dsi_driver.h"
 #elif DISPLAY_DRIVER == DISPLAY_DRIVER_ST7701_DSI
 #include "drivers/st7701_dsi_driver.h"
+#elif DISPLAY_DRIVER == DISPLAY_DRIVER_HEADLESS
+#include "drivers/headless_driver.h"
 #endif
 
 #include <SPI.h>
@@ -29,20 +39,263 @@
 static portMUX_TYPE g_splash_status_mux = portMUX_INITIALIZER_UNLOCKED;
 static portMUX_TYPE g_perf_mux = portMUX_INITIALIZER_UNLOCKED;
 
-static DisplayPerfStats g_perf = {0, 0, 0};
+static DisplayPerfStats g_perf = {};
 static bool g_perf_ready = false;
 static uint32_t g_perf_window_start_ms = 0;
 static uint16_t g_perf_frames_in_window = 0;
+static uint64_t g_perf_bytes_in_window = 0;
+
+// Registered-screen residency, republished by the LVGL task after each switch.
+static DisplayScreenStats g_screen_stats = {};
+static bool g_screen_stats_ready = false;
+
+// Switch → first present timing.  The LVGL task stamps a switch when it picks
+// it up; the frame that renders it is tagged with the present hand-off sequence
+// number so the present task only reports once that frame (not an earlier one
+// still in flight) has been sent.  Direct drivers report inline.
+static uint64_t g_switch_start_us = 0;      // LVGL task only: switch not rendered yet
+static bool g_switch_warm = false;
+static const char* g_switch_id = nullptr;
+static uint32_t g_present_handoffs = 0;     // Written by LVGL task, read by present task
+static uint32_t g_switch_tag_seq = 0;       // Hand-off carrying the switch (0 = none)
+static uint64_t g_switch_tag_start_us = 0;
+static bool g_switch_tag_warm = false;
+static const char* g_switch_tag_id = nullptr;
+
+static void perf_record_switch(uint64_t start_us, bool warm, const char* id) {
+		const uint32_t switch_us = (uint32_t)(esp_timer_get_time() - start_us);
+		portENTER_CRITICAL(&g_perf_mux);
+		g_perf.switch_us = switch_us;
+		g_perf.switch_warm = warm;
+		portEXIT_CRITICAL(&g_perf_mux);
+		LOGI("Display", "Switch to %s: first present after %u us (%s)",
+				 id ? id : "(unregistered)", (unsigned)switch_us, warm ? "warm" : "cold");
+}
+
+// Bytes pushed by flushCallback() during the current LVGL pass (LVGL task only).
+// For Direct drivers this is what reaches the panel; Buffered drivers report
+// their own transfer size via DisplayDriver::lastPresentBytes().
+static uint32_t g_frame_flush_bytes = 0;
+
+// Flush areas in / driver transactions out during the current LVGL pass (LVGL task only),
+// folded into the g_perf_mux-protected window accumulators at the end of each frame.
+static uint32_t g_frame_flush_areas = 0;
+static uint32_t g_frame_flush_tx = 0;
+static uint32_t g_frame_flush_staged = 0;  // DISPLAY_FLUSH_COALESCE copies / merges
+static uint32_t g_frame_flush_merged = 0;
+static uint32_t g_perf_areas_in_window = 0;
+static uint32_t g_perf_tx_in_window = 0;
+static uint32_t g_perf_staged_in_window = 0;
+static uint32_t g_perf_merged_in_window = 0;
+
+// Row-hash results summed over the current ~1 s window (present task only).
+static uint32_t g_perf_rows_hashed_in_window = 0;
+static uint32_t g_perf_rows_skipped_in_window = 0;
+static uint32_t g_perf_row_hash_us_in_window = 0;
+
+// Frame-time histograms (lock-free writers: LVGL task for lv_timer/flush,
+// present task for present). Drained into g_perf every DISPLAY_PERF_HIST_WINDOW_MS
+// by whichever task closes the 1 s perf window.
+static PerfHistogram g_hist_lv_timer = {};
+static PerfHistogram g_hist_flush = {};
+static PerfHistogram g_hist_present = {};
+static uint32_t g_hist_window_start_ms = 0;
+
+static void perf_hist_roll_if_due(uint32_t now_ms) {
+		if (g_hist_window_start_ms == 0) {
+				g_hist_window_start_ms = now_ms;
+				return;
+		}
+		if (now_ms - g_hist_window_start_ms < DISPLAY_PERF_HIST_WINDOW_MS) return;
+		g_hist_window_start_ms = now_ms;
+
+		PerfPercentiles lv, fl, pr;
+		perf_hist_take(&g_hist_lv_timer, &lv);
+		perf_hist_take(&g_hist_flush, &fl);
+		perf_hist_take(&g_hist_present, &pr);
+
+		portENTER_CRITICAL(&g_perf_mux);
+		g_perf.lv_timer_pct = lv;
+		g_perf.flush_pct = fl;
+		g_perf.present_pct = pr;
+		portEXIT_CRITICAL(&g_perf_mux);
+}
+
+// Touch-to-photon latency. The touch read callback marks the capture time of
+// a press (LVGL task); the first frame flushed from then on records
+// touch->flush and, once that frame reaches the panel, touch->present.
+// Presses are sparse, so these histograms accumulate until reset instead of
+// being drained per window.
+static PerfHistogram g_hist_touch_flush = {};
+static PerfHistogram g_hist_touch_present = {};
+static bool g_input_mark_set = false;         // LVGL task only
+static uint32_t g_input_mark_us = 0;          // Capture time (esp_timer low 32 bits)
+static bool g_input_frame_set = false;        // LVGL task only: press in the frame awaiting hand-off
+static uint32_t g_input_frame_us = 0;
+// Press carried by a handed-off frame: the hand-off sequence and the capture
+// time travel together (under g_perf_mux), so a newer press cannot change the
+// time the present task records for an older frame. seq 0 = none.
+struct InputFrameTag {
+		uint32_t seq;
+		uint32_t us;
+};
+static InputFrameTag g_input_tag = {};
+static uint32_t g_input_presses = 0;
+static uint32_t g_input_unmatched = 0;        // No frame within DISPLAY_INPUT_LATENCY_MAX_MS
+static uint32_t g_input_last_flush_us = 0;
+static uint32_t g_input_last_present_us = 0;
+
+static void input_latency_record_present(uint32_t us) {
+		perf_hist_record(&g_hist_touch_present, us);
+		__atomic_store_n(&g_input_last_present_us, us, __ATOMIC_RELAXED);
+}
+
+// LVGL task time split (LVGL task only), published to g_perf once per second
+// regardless of whether any frame was drawn.
+static uint64_t g_sched_window_start_us = 0;
+static uint64_t g_sched_busy_us = 0;
+static uint64_t g_sched_idle_us = 0;
+
+// Render-off accounting (DISPLAY_SLEEP_RENDER_OFF), under g_perf_mux. The
+// totals grow only while awake (nothing is drawn or sent while asleep) and
+// give the awake averages the savings estimates are based on.
+static uint64_t g_lvgl_start_us = 0;
+static uint64_t g_total_busy_us = 0;
+static uint64_t g_total_frames = 0;
+static uint64_t g_total_bytes = 0;
+static uint32_t g_sleep_count = 0;
+static uint64_t g_sleep_total_us = 0;
+static uint64_t g_sleep_start_us = 0;     // 0 = awake
+static bool g_sleep_panel = false;
+static bool g_present_in_flight = false;  // Handed to the present task, present() not done yet
+
+static void sched_roll_if_due(uint64_t now_us) {
+		if (g_sched_window_start_us == 0) {
+				g_sched_window_start_us = now_us;
+				return;
+		}
+		const uint64_t elapsed_us = now_us - g_sched_window_start_us;
+		if (elapsed_us < 1000000ULL) return;
+
+		uint64_t busy_pct = g_sched_busy_us * 100 / elapsed_us;
+		uint64_t idle_pct = g_sched_idle_us * 100 / elapsed_us;
+		if (busy_pct > 100) busy_pct = 100;
+		if (idle_pct > 100) idle_pct = 100;
+
+		portENTER_CRITICAL(&g_perf_mux);
+		g_perf.lvgl_busy_pct = (uint8_t)busy_pct;
+		g_perf.lvgl_idle_pct = (uint8_t)idle_pct;
+		g_total_busy_us += g_sched_busy_us;
+		portEXIT_CRITICAL(&g_perf_mux);
+
+		g_sched_window_start_us = now_us;
+		g_sched_busy_us = 0;
+		g_sched_idle_us = 0;
+}
+
+#if LVGL_IDLE_SCHEDULER
+// True while any input device reports a press (caller holds the LVGL mutex).
+static bool lvgl_input_pressed() {
+		for (lv_indev_t* indev = lv_indev_get_next(NULL); indev; indev = lv_indev_get_next(indev)) {
+				if (lv_indev_get_state(indev) == LV_INDEV_STATE_PRESSED) return true;
+		}
+		return false;
+}
+
+// Invalidated areas LVGL has not rendered yet (caller holds the LVGL mutex).
+static bool lvgl_invalidations_pending(lv_display_t* disp) {
+		return disp && disp->inv_p > 0;
+}
+
+// Milliseconds until the next LVGL timer is due, UINT32_MAX when none is
+// running. The display refresh and indev read timers are left out: they are
+// what the idle wait skips (nothing to refresh without invalidations, input
+// is sampled every LVGL_IDLE_POLL_MS). Caller holds the LVGL mutex.
+static uint32_t lvgl_next_timer_ms(lv_display_t* disp) {
+		const lv_timer_t* refr = disp ? lv_display_get_refr_timer(disp) : nullptr;
+		uint32_t next = UINT32_MAX;
+		for (lv_timer_t* t = lv_timer_get_next(NULL); t; t = lv_timer_get_next(t)) {
+				if (t == refr || t->paused) continue;
+				bool indevTimer = false;
+				for (lv_indev_t* indev = lv_indev_get_next(NULL); indev; indev = lv_indev_get_next(indev)) {
+						if (lv_indev_get_read_timer(indev) == t) {
+								indevTimer = true;
+								break;
+						}
+				}
+				if (indevTimer) continue;
+
+				const uint32_t elapsed = lv_tick_elaps(t->last_run);
+				const uint32_t left = elapsed >= t->period ? 0 : t->period - elapsed;
+				if (left < next) next = left;
+		}
+		return next;
+}
+#endif
+
+// Frame benchmark accumulator. Only written while g_bench_active is set so
+// the render hot path costs a single flag check when no benchmark runs.
+static portMUX_TYPE g_bench_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool g_bench_active = false;
+static DisplayBenchStats g_bench = {};
+static uint32_t g_bench_start_ms = 0;
+// Whole-window distributions (separate from the 1 s g_hist_* windows).
+static PerfHistogram g_bench_hist_lv_timer = {};
+static PerfHistogram g_bench_hist_present = {};
+
+static inline void bench_add_sample(uint32_t value, uint32_t count, uint32_t* min_v, uint32_t* max_v) {
+		if (count == 0 || value < *min_v) *min_v = value;
+		if (count == 0 || value > *max_v) *max_v = value;
+}
+
+static void bench_record_flush(uint32_t pixels) {
+		if (!g_bench_active) return;
+		portENTER_CRITICAL(&g_bench_mux);
+		bench_add_sample(pixels, g_bench.flushes, &g_bench.flush_pixels_min, &g_bench.flush_pixels_max);
+		g_bench.flushes++;
+		g_bench.flush_pixels += pixels;
+		portEXIT_CRITICAL(&g_bench_mux);
+}
+
+static void bench_record_transaction() {
+		if (!g_bench_active) return;
+		portENTER_CRITICAL(&g_bench_mux);
+		g_bench.transactions++;
+		portEXIT_CRITICAL(&g_bench_mux);
+}
+
+static void bench_record_frame(uint32_t lv_timer_us) {
+		if (!g_bench_active) return;
+		portENTER_CRITICAL(&g_bench_mux);
+		bench_add_sample(lv_timer_us, g_bench.frames, &g_bench.lv_timer_us_min, &g_bench.lv_timer_us_max);
+		g_bench.frames++;
+		g_bench.lv_timer_us_sum += lv_timer_us;
+		perf_hist_record(&g_bench_hist_lv_timer, lv_timer_us);
+		portEXIT_CRITICAL(&g_bench_mux);
+}
+
+static void bench_record_present(uint32_t present_us) {
+		if (!g_bench_active) return;
+		portENTER_CRITICAL(&g_bench_mux);
+		bench_add_sample(present_us, g_bench.presents, &g_bench.present_us_min, &g_bench.present_us_max);
+		g_bench.presents++;
+		g_bench.present_us_sum += present_us;
+		perf_hist_record(&g_bench_hist_present, present_us);
+		portEXIT_CRITICAL(&g_bench_mux);
+}
 
 // Global instance
 DisplayManager* displayManager = nullptr;
 
 DisplayManager::DisplayManager(DeviceConfig* cfg) 
-		: driver(nullptr), display(nullptr), config(cfg), currentScreen(nullptr), previousScreen(nullptr), pendingScreen(nullptr), 
-			infoScreen(cfg, this), testScreen(this), fpsScreen(this),
+		: driver(nullptr), display(nullptr), config(cfg), currentScreen(nullptr), previousScreen(nullptr), pendingScreen(nullptr), pendingWarm(nullptr), warmArmed(DISPLAY_SCREEN_PREWARM),
+			infoScreen(this), testScreen(this), fpsScreen(this), fpsComplexScreen(this, true),
 							lvglTaskHandle(nullptr), lvglTaskAlloc{}, lvglMutex(nullptr),
 						presentTaskHandle(nullptr), presentTaskAlloc{}, presentSem(nullptr), sharedLvTimerUs(0),
-						screenCount(0), buf(nullptr), buf2(nullptr), flushPending(false), pendingSplashStatusSet(false) {
+						availableScreens(nullptr), screenCount(0), screenCapacity(0), screenSlots(nullptr), screenCreates(0), screenEvictions(0), screenPrewarms(0), buf(nullptr), buf2(nullptr),
+						coalesceBuf(nullptr), coalesceCapacityPx(0), coalescePending(false), coalesceArea{},
+						flushPending(false), presentPending(false),
+						renderSleepRequested(false), renderAsleep(false), panelAsleep(false), pendingSplashStatusSet(false) {
 				pendingSplashStatus[0] = '\0';
 		// Instantiate selected display driver
 		#if DISPLAY_DRIVER == DISPLAY_DRIVER_TFT_ESPI
@@ -57,6 +310,8 @@ DisplayManager::DisplayManager(DeviceConfig* cfg)
 		driver = new ST7703_DSI_Driver();
 		#elif DISPLAY_DRIVER == DISPLAY_DRIVER_ST7701_DSI
 		driver = new ST7701_DSI_Driver();
+		#elif DISPLAY_DRIVER == DISPLAY_DRIVER_HEADLESS
+		driver = new Headless_Driver();
 		#else
 		#error "No display driver selected or unknown driver type"
 		#endif
@@ -65,12 +320,12 @@ DisplayManager::DisplayManager(DeviceConfig* cfg)
 		lvglMutex = xSemaphoreCreateMutex();
 		
 		// Initialize screen registry (exclude splash - it's boot-specific)
-		availableScreens[0] = {"info", "Info Screen", &infoScreen};
-		availableScreens[1] = {"test", "Display Test", &testScreen};
-		availableScreens[2] = {"fps", "FPS Benchmark", &fpsScreen};
-		screenCount = 3;
+		registerScreen("info", "Info Screen", &infoScreen);
+		registerScreen("test", "Display Test", &testScreen);
+		registerScreen("fps", "FPS Benchmark", &fpsScreen);
+		registerScreen("fps_complex", "FPS Benchmark (Complex)", &fpsComplexScreen);
 		#if HAS_TOUCH && LV_USE_CANVAS
-		availableScreens[screenCount++] = {"touch_test", "Touch Test", &touchTestScreen};
+		registerScreen("touch_test", "Touch Test", &touchTestScreen);
 		#endif
 }
 
@@ -99,6 +354,7 @@ DisplayManager::~DisplayManager() {
 		infoScreen.destroy();
 		testScreen.destroy();
 		fpsScreen.destroy();
+		fpsComplexScreen.destroy();
 		#if HAS_TOUCH && LV_USE_CANVAS
 		touchTestScreen.destroy();
 		#endif
@@ -124,6 +380,16 @@ DisplayManager::~DisplayManager() {
 				heap_caps_free(buf2);
 				buf2 = nullptr;
 		}
+		if (coalesceBuf) {
+				heap_caps_free(coalesceBuf);
+				coalesceBuf = nullptr;
+		}
+
+		free(availableScreens);
+		free(screenSlots);
+		availableScreens = nullptr;
+		screenSlots = nullptr;
+		screenCount = screenCapacity = 0;
 }
 
 const char* DisplayManager::getScreenIdForInstance(const Screen* screen) const {
@@ -154,14 +420,17 @@ void DisplayManager::flushCallback(lv_display_t *disp, const lv_area_t *area, ui
 		// v9 stride: rows in px_map may be padded for cache-line alignment.
 		// Tell the driver so it can advance the source pointer correctly.
 		uint32_t stride = lv_draw_buf_width_to_stride(w, lv_display_get_color_format(disp));
-		mgr->driver->flushSrcStride = stride;
 		
-		// Push pixels to display via driver HAL.
-		bool swap = (mgr->driver->renderMode() != DisplayDriver::RenderMode::Buffered);
-		mgr->driver->startWrite();
-		mgr->driver->setAddrWindow(area->x1, area->y1, w, h);
-		mgr->driver->pushColors((uint16_t *)px_map, w * h, swap);
-		mgr->driver->endWrite();
+		g_frame_flush_areas++;
+		bench_record_flush(w * h);
+
+		if (mgr->coalesceBuf) {
+				// Stage the area (px_map is reused after flush_ready) and send the
+				// merged run once LVGL has handed over the last area of this refresh.
+				mgr->coalesceStage(area, px_map, stride, lv_display_flush_is_last(disp));
+		} else {
+				mgr->pushArea(area->x1, area->y1, w, h, (uint16_t *)px_map, stride);
+		}
 
 		// Signal that the driver may need a post-render present() step.
 		if (mgr) {
@@ -175,6 +444,71 @@ void DisplayManager::flushCallback(lv_display_t *disp, const lv_area_t *area, ui
 		}
 }
 
+void DisplayManager::pushArea(int32_t x, int32_t y, uint32_t w, uint32_t h, uint16_t* pixels, uint32_t strideBytes) {
+		driver->flushSrcStride = strideBytes;
+		
+		// Push pixels to display via driver HAL.
+		bool swap = (driver->renderMode() != DisplayDriver::RenderMode::Buffered);
+		const uint64_t start_us = esp_timer_get_time();
+		driver->startWrite();
+		driver->setAddrWindow(x, y, w, h);
+		driver->pushColors(pixels, w * h, swap);
+		driver->endWrite();
+		perf_hist_record(&g_hist_flush, (uint32_t)(esp_timer_get_time() - start_us));
+
+		g_frame_flush_bytes += w * h * sizeof(uint16_t);
+		g_frame_flush_tx++;
+		bench_record_transaction();
+}
+
+void DisplayManager::coalesceStage(const lv_area_t* area, const uint8_t* px_map, uint32_t strideBytes, bool last) {
+		const uint32_t w = (area->x2 - area->x1 + 1);
+		const uint32_t h = (area->y2 - area->y1 + 1);
+
+		// Only small areas are worth a copy: there the bus setup costs as much as
+		// the pixels. Large strips go straight from px_map.
+		const bool small = w * h <= DISPLAY_FLUSH_COALESCE_MAX_AREA_PX;
+
+		// Append to the staged run when the result is still one rectangle:
+		// same x-span, starting on the row right below it, and room left.
+		if (coalescePending) {
+				const uint32_t stagedRows = (uint32_t)(coalesceArea.y2 - coalesceArea.y1 + 1);
+				if (small && area->x1 == coalesceArea.x1 && area->x2 == coalesceArea.x2
+						&& area->y1 == coalesceArea.y2 + 1
+						&& (stagedRows + h) * w <= coalesceCapacityPx) {
+						rgb565_copy_rect(coalesceBuf + (size_t)stagedRows * w, w,
+								(const uint16_t*)px_map, strideBytes / sizeof(uint16_t), w, h, false);
+						coalesceArea.y2 = area->y2;
+						g_frame_flush_staged++;
+						g_frame_flush_merged++;
+						if (last) coalesceFlush();
+						return;
+				}
+				coalesceFlush();
+		}
+
+		// Nothing can follow it (last area), too large to be worth a copy, or
+		// larger than the staging buffer: send straight from px_map. A refresh
+		// with a single area never copies.
+		if (last || !small || w * h > coalesceCapacityPx) {
+				pushArea(area->x1, area->y1, w, h, (uint16_t*)px_map, strideBytes);
+				return;
+		}
+
+		rgb565_copy_rect(coalesceBuf, w, (const uint16_t*)px_map, strideBytes / sizeof(uint16_t), w, h, false);
+		coalesceArea = *area;
+		coalescePending = true;
+		g_frame_flush_staged++;
+}
+
+void DisplayManager::coalesceFlush() {
+		if (!coalescePending) return;
+		const uint32_t w = (coalesceArea.x2 - coalesceArea.x1 + 1);
+		const uint32_t h = (coalesceArea.y2 - coalesceArea.y1 + 1);
+		pushArea(coalesceArea.x1, coalesceArea.y1, w, h, coalesceBuf, w * sizeof(uint16_t));
+		coalescePending = false;
+}
+
 bool DisplayManager::isInLvglTask() const {
 		if (!lvglTaskHandle) return false;
 		return xTaskGetCurrentTaskHandle() == lvglTaskHandle;
@@ -205,6 +539,68 @@ void DisplayManager::unlock() {
 		if (lvglMutex) {
 				xSemaphoreGive(lvglMutex);
 		}
+		// Another task may have just changed LVGL objects: let an idle render loop pick it up.
+		if (!isInLvglTask()) {
+				wake();
+		}
+}
+
+void DisplayManager::wake() {
+		#if LVGL_IDLE_SCHEDULER
+		if (lvglTaskHandle) {
+				xTaskNotifyGive(lvglTaskHandle);
+		}
+		#endif
+}
+
+void DisplayManager::setRenderSleep(bool sleep) {
+		#if DISPLAY_SLEEP_RENDER_OFF
+		renderSleepRequested = sleep;
+		if (lvglTaskHandle) {
+				xTaskNotifyGive(lvglTaskHandle);  // Also ends a render-off park
+		}
+		#else
+		(void)sleep;
+		#endif
+}
+
+// LVGL task, mutex held, no frame in flight.
+void DisplayManager::enterRenderSleep() {
+		renderAsleep = true;
+		#if DISPLAY_SLEEP_PANEL
+		panelAsleep = driver->setPanelSleep(true);
+		#endif
+
+		portENTER_CRITICAL(&g_perf_mux);
+		g_sleep_count++;
+		g_sleep_start_us = esp_timer_get_time();
+		g_sleep_panel = panelAsleep;
+		portEXIT_CRITICAL(&g_perf_mux);
+
+		LOGI("Display", "Render off (panel %s)", panelAsleep ? "sleep-in" : "on");
+}
+
+// LVGL task, mutex held.
+void DisplayManager::exitRenderSleep() {
+		if (panelAsleep) {
+				driver->setPanelSleep(false);
+				panelAsleep = false;
+		}
+		renderAsleep = false;
+
+		// Replay one full frame: a sleeping panel may not have kept its content,
+		// and whatever was invalidated meanwhile is folded into the same redraw.
+		lv_obj_invalidate(lv_screen_active());
+
+		const uint64_t now_us = esp_timer_get_time();
+		portENTER_CRITICAL(&g_perf_mux);
+		const uint64_t slept_us = now_us - g_sleep_start_us;
+		g_sleep_total_us += slept_us;
+		g_sleep_start_us = 0;
+		g_sleep_panel = false;
+		portEXIT_CRITICAL(&g_perf_mux);
+
+		LOGI("Display", "Render on after %lu ms", (unsigned long)(slept_us / 1000));
 }
 
 bool DisplayManager::tryLock(uint32_t timeoutMs) {
@@ -217,9 +613,41 @@ void DisplayManager::lvglTask(void* pvParameter) {
 		DisplayManager* mgr = (DisplayManager*)pvParameter;
 		
 		LOGI("Display", "LVGL render task start (core %d)", xPortGetCoreID());
+		g_lvgl_start_us = esp_timer_get_time();
+
+		#if LVGL_IDLE_SCHEDULER
+		uint32_t lastActivityMs = millis();
+		bool idle = false;
+		#endif
 		
 		while (true) {
 				mgr->lock();
+				const uint64_t pass_start_us = esp_timer_get_time();
+
+				#if DISPLAY_SLEEP_RENDER_OFF
+				// Render-off: go to sleep once the last frame has reached the panel.
+				// While asleep LVGL is not run at all (timers, input, Screen::update()
+				// and pending switches wait for the wake).
+				if (mgr->renderSleepRequested != mgr->renderAsleep) {
+						if (mgr->renderAsleep) {
+								mgr->exitRenderSleep();
+						} else if (!mgr->flushPending && !mgr->presentPending
+								&& !__atomic_load_n(&g_present_in_flight, __ATOMIC_ACQUIRE)) {
+								mgr->enterRenderSleep();
+						}
+				}
+				if (mgr->renderAsleep) {
+						mgr->unlock();
+						const uint64_t park_us = esp_timer_get_time();
+						g_sched_busy_us += park_us - pass_start_us;
+						// setRenderSleep(false) notifies; the timeout keeps the busy/idle stats rolling.
+						ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+						const uint64_t woke_us = esp_timer_get_time();
+						g_sched_idle_us += woke_us - park_us;
+						sched_roll_if_due(woke_us);
+						continue;
+				}
+				#endif
 
 				// Apply any deferred splash status update.
 				if (mgr->pendingSplashStatusSet) {
@@ -240,6 +668,11 @@ void DisplayManager::lvglTask(void* pvParameter) {
 				// Process pending screen switch (deferred from external calls)
 				if (mgr->pendingScreen) {
 						Screen* target = mgr->pendingScreen;
+						const int targetSlot = mgr->findScreenSlot(target);
+						g_switch_start_us = esp_timer_get_time();
+						g_switch_warm = targetSlot < 0 || mgr->screenSlots[targetSlot].created;
+						g_switch_id = targetSlot >= 0 ? mgr->availableScreens[targetSlot].id : nullptr;
+						mgr->ensureScreenCreated(target);
 						if (mgr->currentScreen) {
 								mgr->currentScreen->hide();
 						}
@@ -249,6 +682,17 @@ void DisplayManager::lvglTask(void* pvParameter) {
 						mgr->currentScreen->show();
 						mgr->pendingScreen = nullptr;
 
+						// LRU bookkeeping: the outgoing screen was in use until now.
+						const uint32_t nowMs = millis();
+						const int prevSlot = mgr->findScreenSlot(mgr->previousScreen);
+						if (prevSlot >= 0) mgr->screenSlots[prevSlot].lastShownMs = nowMs;
+						if (targetSlot >= 0) mgr->screenSlots[targetSlot].lastShownMs = nowMs;
+						mgr->enforceScreenBudget();
+						mgr->publishScreenStats();
+						#if DISPLAY_SCREEN_PREWARM
+						mgr->warmArmed = true;
+						#endif
+
 						// Reset LVGL input device state so leftover PRESSED from the
 						// previous screen doesn't fire a phantom CLICKED on the new screen.
 						lv_indev_reset(NULL, NULL);
@@ -267,16 +711,74 @@ void DisplayManager::lvglTask(void* pvParameter) {
 						mgr->currentScreen->update();
 				}
 				
+				#if LVGL_IDLE_SCHEDULER
+				// Quiet pass: nothing drawn or left to draw, nothing waiting for
+				// present, no running animation and no finger on the panel.
+				const bool quiet = !mgr->flushPending && !mgr->presentPending
+						&& !lvgl_invalidations_pending(mgr->display)
+						&& lv_anim_count_running() == 0 && !lvgl_input_pressed();
+				// Bounds the idle wait so LVGL timers shorter than the poll still fire on time.
+				const uint32_t nextTimerMs = lvgl_next_timer_ms(mgr->display);
+				#endif
+				
+				const bool drewFrame = mgr->flushPending;
+
+				// A press LVGL read in this or an earlier pass: the indev read timer is
+				// created after the display's refresh timer and LVGL runs newer timers
+				// first, so a frame flushed in the same pass already includes it.
+				uint32_t inputTagUs = 0;
+				bool inputTagged = false;
+				if (g_input_mark_set) {
+						const uint32_t age_us = (uint32_t)esp_timer_get_time() - g_input_mark_us;
+						if (mgr->flushPending) {
+								perf_hist_record(&g_hist_touch_flush, age_us);
+								__atomic_store_n(&g_input_last_flush_us, age_us, __ATOMIC_RELAXED);
+								inputTagUs = g_input_mark_us;
+								inputTagged = true;
+								g_input_mark_set = false;
+						} else if (age_us > (uint32_t)DISPLAY_INPUT_LATENCY_MAX_MS * 1000) {
+								__atomic_fetch_add(&g_input_unmatched, 1, __ATOMIC_RELAXED);
+								g_input_mark_set = false;
+						}
+				}
+
 				// Flush canvas buffer only when LVGL produced draw data.
 				if (mgr->flushPending) {
+						bench_record_frame(lv_timer_us);
+						perf_hist_record(&g_hist_lv_timer, lv_timer_us);
+						const uint32_t frame_flush_bytes = g_frame_flush_bytes;
+						g_frame_flush_bytes = 0;
+						portENTER_CRITICAL(&g_perf_mux);
+						g_perf_areas_in_window += g_frame_flush_areas;
+						g_perf_tx_in_window += g_frame_flush_tx;
+						g_perf_staged_in_window += g_frame_flush_staged;
+						g_perf_merged_in_window += g_frame_flush_merged;
+						portEXIT_CRITICAL(&g_perf_mux);
+						g_frame_flush_areas = 0;
+						g_frame_flush_tx = 0;
+						g_frame_flush_staged = 0;
+						g_frame_flush_merged = 0;
 						if (mgr->driver->renderMode() == DisplayDriver::RenderMode::Buffered
 								&& mgr->presentSem) {
 								// Buffered mode: delegate present() to the async present task.
 								// This frees the LVGL mutex during the slow QSPI panel transfer,
 								// allowing touch input and animations to continue processing.
 								mgr->sharedLvTimerUs = lv_timer_us;
-								xSemaphoreGive(mgr->presentSem);
+								mgr->presentPending = true;
+								if (inputTagged && !g_input_frame_set) {
+										g_input_frame_us = inputTagUs;
+										g_input_frame_set = true;  // Bound to a sequence at hand-off
+								}
 						} else {
+								if (inputTagged) {
+										// Direct drivers: the flush was the panel write.
+										input_latency_record_present((uint32_t)esp_timer_get_time() - inputTagUs);
+								}
+								if (g_switch_start_us) {
+										perf_record_switch(g_switch_start_us, g_switch_warm, g_switch_id);
+										g_switch_start_us = 0;
+								}
+
 								// Direct mode: present() is a no-op. Update perf stats inline.
 								const uint32_t now_ms = millis();
 								if (g_perf_window_start_ms == 0) {
@@ -285,33 +787,124 @@ void DisplayManager::lvglTask(void* pvParameter) {
 								}
 
 								g_perf_frames_in_window++;
+								g_perf_bytes_in_window += frame_flush_bytes;
 
 								const uint32_t elapsed = now_ms - g_perf_window_start_ms;
 								if (elapsed >= 1000) {
 										const uint16_t fps = g_perf_frames_in_window;
-										
+										const uint32_t bytes_per_frame = (uint32_t)(g_perf_bytes_in_window / g_perf_frames_in_window);
 
 										portENTER_CRITICAL(&g_perf_mux);
 										g_perf.fps = fps;
 										g_perf.lv_timer_us = lv_timer_us;
 										g_perf.present_us = 0;
+										g_perf.bytes_per_frame = bytes_per_frame;
+										g_perf.flush_areas = g_perf_areas_in_window;
+										g_perf.flush_transactions = g_perf_tx_in_window;
+										g_perf.flush_staged = g_perf_staged_in_window;
+										g_perf.flush_merged = g_perf_merged_in_window;
+										g_perf_areas_in_window = 0;
+										g_perf_tx_in_window = 0;
+										g_perf_staged_in_window = 0;
+										g_perf_merged_in_window = 0;
 										g_perf_ready = true;
+										g_total_frames += g_perf_frames_in_window;
+										g_total_bytes += g_perf_bytes_in_window;
 										portEXIT_CRITICAL(&g_perf_mux);
 
 										g_perf_window_start_ms = now_ms;
 										g_perf_frames_in_window = 0;
+										g_perf_bytes_in_window = 0;
+
+										perf_hist_roll_if_due(now_ms);
 								}
 						}
 						mgr->flushPending = false;
 				}
+
+				// Hand the finished frame to the present task. Double-buffered drivers
+				// refuse while the front buffer is still being sent; the frame stays
+				// pending (further draws accumulate into the back buffer) and is
+				// retried on the next pass.
+				if (mgr->presentPending && mgr->driver->commitFrame()) {
+						mgr->presentPending = false;
+						const uint32_t seq = g_present_handoffs + 1;
+						if (g_switch_start_us) {
+								g_switch_tag_start_us = g_switch_start_us;
+								g_switch_tag_warm = g_switch_warm;
+								g_switch_tag_id = g_switch_id;
+								__atomic_store_n(&g_switch_tag_seq, seq, __ATOMIC_RELEASE);
+								g_switch_start_us = 0;
+						}
+						if (g_input_frame_set) {
+								// A press still waiting for its own present keeps the tag.
+								portENTER_CRITICAL(&g_perf_mux);
+								if (g_input_tag.seq == 0) g_input_tag = {seq, g_input_frame_us};
+								portEXIT_CRITICAL(&g_perf_mux);
+								g_input_frame_set = false;
+						}
+						__atomic_store_n(&g_present_handoffs, seq, __ATOMIC_RELEASE);
+						__atomic_store_n(&g_present_in_flight, true, __ATOMIC_RELEASE);
+						xSemaphoreGive(mgr->presentSem);
+				}
+
+				// Pre-warm in a pass that drew nothing, once the last switch has been
+				// rendered: an explicit prewarmScreen() request, else
+				// (DISPLAY_SCREEN_PREWARM) the predicted next screen.
+				if (!drewFrame && !mgr->presentPending && !mgr->pendingScreen && g_switch_start_us == 0
+						&& (mgr->pendingWarm || mgr->warmArmed)) {
+						Screen* warm = mgr->pendingWarm;
+						mgr->pendingWarm = nullptr;
+						if (!warm && mgr->warmArmed) {
+								warm = mgr->predictNextScreen();
+						}
+						mgr->warmArmed = false;
+						if (warm) {
+								mgr->warmScreen(warm);
+						}
+				}
 				
 				mgr->unlock();
+
+				const uint64_t pass_end_us = esp_timer_get_time();
+				g_sched_busy_us += pass_end_us - pass_start_us;
+				
+				#if LVGL_IDLE_SCHEDULER
+				// Idle-aware scheduling: after LVGL_IDLE_ENTER_MS of quiet passes, stop
+				// spinning on LVGL's refresh/input timers and park on the task
+				// notification. wake() (screen switch, splash status, any external
+				// LVGL access) returns immediately; LVGL_IDLE_POLL_MS keeps input and
+				// Screen::update() sampled at a low rate. The wait ends early for the
+				// next LVGL timer; one that is already due skips the park.
+				const uint32_t now_ms = millis();
+				if (!quiet) {
+						lastActivityMs = now_ms;
+						if (idle) {
+								idle = false;
+								LOGD("Display", "Scheduler active");
+						}
+				} else if (!idle && (now_ms - lastActivityMs) >= LVGL_IDLE_ENTER_MS) {
+						idle = true;
+						LOGD("Display", "Scheduler idle");
+				}
+				const uint32_t idleWaitMs = nextTimerMs < (uint32_t)LVGL_IDLE_POLL_MS ? nextTimerMs : (uint32_t)LVGL_IDLE_POLL_MS;
+				if (idle && idleWaitMs > 0 && !mgr->pendingScreen && !mgr->pendingSplashStatusSet) {
+						ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idleWaitMs));
+						const uint64_t woke_us = esp_timer_get_time();
+						g_sched_idle_us += woke_us - pass_end_us;
+						sched_roll_if_due(woke_us);
+						continue;
+				}
+				#endif
 				
 				// Sleep based on LVGL's suggested next timer deadline.
 				// Clamp to keep UI responsive while avoiding busy looping on static screens.
 				if (delayMs < 1) delayMs = 1;
 				if (delayMs > 20) delayMs = 20;
+				// Retry a deferred frame hand-off soon after the present task frees the front buffer.
+				if (mgr->presentPending && delayMs > 2) delayMs = 2;
 				vTaskDelay(pdMS_TO_TICKS(delayMs));
+				sched_roll_if_due(esp_timer_get_time());
 		}
 }
 
@@ -320,6 +913,8 @@ void DisplayManager::lvglTask(void* pvParameter) {
 // framebuffer while pushColors() may be writing to it.  The dirty-
 // row spinlock in the driver ensures no tracking data is lost; pixel-
 // level overlap is harmless (minor one-frame tear, self-correcting).
+// Double-buffered drivers avoid the overlap: commitFrame() hands over a
+// finished front buffer and pushColors() only touches the back buffer.
 void DisplayManager::presentTask(void* pvParameter) {
 		DisplayManager* mgr = (DisplayManager*)pvParameter;
 		
@@ -330,9 +925,28 @@ void DisplayManager::presentTask(void* pvParameter) {
 				xSemaphoreTake(mgr->presentSem, portMAX_DELAY);
 				
 				// Time the QSPI panel transfer
+				const uint32_t seq = __atomic_load_n(&g_present_handoffs, __ATOMIC_ACQUIRE);
 				const uint64_t start_us = esp_timer_get_time();
 				mgr->driver->present();
 				const uint32_t present_us = (uint32_t)(esp_timer_get_time() - start_us);
+				__atomic_store_n(&g_present_in_flight, false, __ATOMIC_RELEASE);
+
+				// First present covering a screen switch?
+				const uint32_t tag = __atomic_load_n(&g_switch_tag_seq, __ATOMIC_ACQUIRE);
+				if (tag && (int32_t)(seq - tag) >= 0) {
+						__atomic_store_n(&g_switch_tag_seq, 0, __ATOMIC_RELAXED);
+						perf_record_switch(g_switch_tag_start_us, g_switch_tag_warm, g_switch_tag_id);
+				}
+				portENTER_CRITICAL(&g_perf_mux);
+				const InputFrameTag inputTag = g_input_tag;
+				const bool inputPresented = inputTag.seq && (int32_t)(seq - inputTag.seq) >= 0;
+				if (inputPresented) g_input_tag.seq = 0;
+				portEXIT_CRITICAL(&g_perf_mux);
+				if (inputPresented) {
+						input_latency_record_present((uint32_t)esp_timer_get_time() - inputTag.us);
+				}
+				bench_record_present(present_us);
+				perf_hist_record(&g_hist_present, present_us);
 				
 				// Update perf stats (frame count + periodic publish).
 				// These statics are only accessed from one task context per board
@@ -343,20 +957,46 @@ void DisplayManager::presentTask(void* pvParameter) {
 						g_perf_frames_in_window = 0;
 				}
 				g_perf_frames_in_window++;
+				g_perf_bytes_in_window += mgr->driver->lastPresentBytes();
+				const DisplayDriver::RowHashStats rowHash = mgr->driver->lastPresentRowHash();
+				g_perf_rows_hashed_in_window += rowHash.rows_hashed;
+				g_perf_rows_skipped_in_window += rowHash.rows_skipped;
+				g_perf_row_hash_us_in_window += rowHash.hash_us;
 				
 				const uint32_t elapsed = now_ms - g_perf_window_start_ms;
 				if (elapsed >= 1000) {
 						const uint16_t fps = g_perf_frames_in_window;
 						const uint32_t lv_us = mgr->sharedLvTimerUs;
+						const uint32_t bytes_per_frame = (uint32_t)(g_perf_bytes_in_window / g_perf_frames_in_window);
 						portENTER_CRITICAL(&g_perf_mux);
 						g_perf.fps = fps;
 						g_perf.lv_timer_us = lv_us;
 						g_perf.present_us = present_us;
+						g_perf.bytes_per_frame = bytes_per_frame;
+						g_perf.flush_areas = g_perf_areas_in_window;
+						g_perf.flush_transactions = g_perf_tx_in_window;
+						g_perf.flush_staged = g_perf_staged_in_window;
+						g_perf.flush_merged = g_perf_merged_in_window;
+						g_perf.rows_hashed = g_perf_rows_hashed_in_window;
+						g_perf.rows_skipped = g_perf_rows_skipped_in_window;
+						g_perf.row_hash_us = g_perf_row_hash_us_in_window;
+						g_perf_areas_in_window = 0;
+						g_perf_tx_in_window = 0;
+						g_perf_staged_in_window = 0;
+						g_perf_merged_in_window = 0;
 						g_perf_ready = true;
+						g_total_frames += g_perf_frames_in_window;
+						g_total_bytes += g_perf_bytes_in_window;
 						portEXIT_CRITICAL(&g_perf_mux);
 						
 						g_perf_window_start_ms = now_ms;
 						g_perf_frames_in_window = 0;
+						g_perf_bytes_in_window = 0;
+						g_perf_rows_hashed_in_window = 0;
+						g_perf_rows_skipped_in_window = 0;
+						g_perf_row_hash_us_in_window = 0;
+						
+						perf_hist_roll_if_due(now_ms);
 				}
 		}
 }
@@ -373,6 +1013,111 @@ bool display_manager_get_perf_stats(DisplayPerfStats* out) {
 		return ok;
 }
 
+void display_manager_mark_input(uint32_t capture_us) {
+		// Keep the oldest unanswered press: that is the one the user is waiting on.
+		if (g_input_mark_set) return;
+		g_input_mark_us = capture_us;
+		g_input_mark_set = true;
+		__atomic_fetch_add(&g_input_presses, 1, __ATOMIC_RELAXED);
+}
+
+bool display_manager_get_input_latency(DisplayInputLatency* out) {
+		if (!out) return false;
+		perf_hist_peek(&g_hist_touch_flush, &out->touch_flush);
+		perf_hist_peek(&g_hist_touch_present, &out->touch_present);
+		out->presses = __atomic_load_n(&g_input_presses, __ATOMIC_RELAXED);
+		out->unmatched = __atomic_load_n(&g_input_unmatched, __ATOMIC_RELAXED);
+		out->last_flush_us = __atomic_load_n(&g_input_last_flush_us, __ATOMIC_RELAXED);
+		out->last_present_us = __atomic_load_n(&g_input_last_present_us, __ATOMIC_RELAXED);
+		return true;
+}
+
+void display_manager_reset_input_latency() {
+		perf_hist_reset(&g_hist_touch_flush);
+		perf_hist_reset(&g_hist_touch_present);
+		__atomic_store_n(&g_input_presses, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&g_input_unmatched, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&g_input_last_flush_us, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&g_input_last_present_us, 0, __ATOMIC_RELAXED);
+}
+
+bool display_manager_get_sleep_stats(DisplaySleepStats* out) {
+		if (!out || g_lvgl_start_us == 0) return false;
+		const uint64_t now_us = esp_timer_get_time();
+
+		portENTER_CRITICAL(&g_perf_mux);
+		const bool asleep = g_sleep_start_us != 0;
+		const uint64_t asleep_us = g_sleep_total_us + (asleep ? now_us - g_sleep_start_us : 0);
+		const uint64_t busy_us = g_total_busy_us;
+		const uint64_t frames = g_total_frames;
+		const uint64_t bytes = g_total_bytes;
+		out->sleeps = g_sleep_count;
+		out->panel_sleep = g_sleep_panel;
+		portEXIT_CRITICAL(&g_perf_mux);
+
+		const uint64_t run_us = now_us - g_lvgl_start_us;
+		const double awake_us = run_us > asleep_us ? (double)(run_us - asleep_us) : 0.0;
+		const double share = awake_us > 0.0 ? (double)asleep_us / awake_us : 0.0;  // asleep per awake us
+		out->asleep = asleep;
+		out->asleep_ms = (uint32_t)(asleep_us / 1000);
+		out->cpu_saved_ms = (uint32_t)((double)busy_us * share / 1000.0);
+		out->frames_skipped = (uint32_t)((double)frames * share);
+		out->kb_skipped = (uint32_t)((double)bytes * share / 1024.0);
+		out->saved_mah = (uint32_t)((double)DISPLAY_SLEEP_SAVED_MA * (double)asleep_us / 3.6e9);
+		return true;
+}
+
+bool display_manager_get_screen_stats(DisplayScreenStats* out) {
+		if (!out) return false;
+		bool ok = false;
+		portENTER_CRITICAL(&g_perf_mux);
+		ok = g_screen_stats_ready;
+		if (ok) {
+				*out = g_screen_stats;
+		}
+		portEXIT_CRITICAL(&g_perf_mux);
+		return ok;
+}
+
+bool display_manager_get_flush_dma_stats(DisplayFlushDmaStats* out) {
+		if (!out || !displayManager || !displayManager->getDriver()) return false;
+		DisplayDriver::FlushDmaStats s;
+		if (!displayManager->getDriver()->flushDmaStats(&s)) return false;
+
+		out->transfers = s.transfers;
+		out->waits = s.waits;
+		out->overlap_pct = s.wire_us ? (uint8_t)((s.wire_us - s.stall_us) * 100 / s.wire_us) : 0;
+		out->stall_ms = (uint32_t)(s.stall_us / 1000);
+		return true;
+}
+
+void display_manager_bench_begin() {
+		const uint32_t now_ms = millis();
+		portENTER_CRITICAL(&g_bench_mux);
+		g_bench = {};
+		perf_hist_reset(&g_bench_hist_lv_timer);
+		perf_hist_reset(&g_bench_hist_present);
+		g_bench_start_ms = now_ms;
+		g_bench_active = true;
+		portEXIT_CRITICAL(&g_bench_mux);
+}
+
+bool display_manager_bench_end(DisplayBenchStats* out) {
+		bool ok = false;
+		const uint32_t now_ms = millis();
+		portENTER_CRITICAL(&g_bench_mux);
+		ok = g_bench_active;
+		g_bench_active = false;
+		if (ok && out) {
+				*out = g_bench;
+				out->window_ms = now_ms - g_bench_start_ms;
+				perf_hist_take(&g_bench_hist_lv_timer, &out->lv_timer_pct);
+				perf_hist_take(&g_bench_hist_present, &out->present_pct);
+		}
+		portEXIT_CRITICAL(&g_bench_mux);
+		return ok;
+}
+
 void DisplayManager::initHardware() {
 		LOGI("Display", "Init start");
 		
@@ -406,6 +1151,9 @@ void DisplayManager::initLVGL() {
 		
 		lv_init();
 
+		// Compressed PNG assets (png2lvgl_assets.py --compress) + decoded image cache
+		lvgl_asset_decoder_init();
+
 		// Register tick callback (replaces v8 LV_TICK_CUSTOM macro)
 		lv_tick_set_cb([]() -> uint32_t { return (uint32_t)millis(); });
 		
@@ -426,7 +1174,10 @@ void DisplayManager::initLVGL() {
 		const size_t buf_size_bytes = LVGL_BUFFER_SIZE * sizeof(uint16_t);
 		const size_t buf_align = LV_DRAW_BUF_ALIGN;
 		
-		if (LVGL_BUFFER_PREFER_INTERNAL) {
+		// DMA flush (TFT_ESPI_DMA_FLUSH) reads the draw buffers over SPI DMA,
+		// which on ESP32/S3 cannot reach PSRAM.
+		const bool preferInternal = LVGL_BUFFER_PREFER_INTERNAL || TFT_ESPI_DMA_FLUSH;
+		if (preferInternal) {
 				buf = (uint8_t*)heap_caps_aligned_alloc(buf_align, buf_size_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
 				if (!buf) {
 						LOGW("Display", "Internal RAM alloc failed, trying PSRAM...");
@@ -448,7 +1199,7 @@ void DisplayManager::initLVGL() {
 		// Allocate second buffer for double-buffering if configured
 		buf2 = NULL;
 		#if defined(LVGL_DRAW_BUF_COUNT) && LVGL_DRAW_BUF_COUNT == 2
-		if (LVGL_BUFFER_PREFER_INTERNAL) {
+		if (preferInternal) {
 				buf2 = (uint8_t*)heap_caps_aligned_alloc(buf_align, buf_size_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
 		} else {
 				buf2 = (uint8_t*)heap_caps_aligned_alloc(buf_align, buf_size_bytes, MALLOC_CAP_SPIRAM);
@@ -463,6 +1214,25 @@ void DisplayManager::initLVGL() {
 		// Set buffers on display (v9 API)
 		lv_display_set_buffers(display, buf, buf2, buf_size_bytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
 		
+		// Flush-area coalescing staging buffer. Only for Direct drivers that
+		// complete synchronously: Buffered drivers already copy into a
+		// framebuffer, and async (DMA) drivers still own px_map after flush.
+		#if DISPLAY_FLUSH_COALESCE
+		if (driver->renderMode() == DisplayDriver::RenderMode::Direct && !driver->asyncFlush()) {
+				const size_t coalesce_bytes = (size_t)DISPLAY_FLUSH_COALESCE_PIXELS * sizeof(uint16_t);
+				coalesceBuf = (uint16_t*)heap_caps_malloc(coalesce_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+				if (!coalesceBuf) {
+						coalesceBuf = (uint16_t*)heap_caps_malloc(coalesce_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+				}
+				if (coalesceBuf) {
+						coalesceCapacityPx = DISPLAY_FLUSH_COALESCE_PIXELS;
+						LOGI("Display", "Flush coalescing enabled: %u bytes staging", (unsigned)coalesce_bytes);
+				} else {
+						LOGW("Display", "Flush coalescing disabled: staging alloc failed (%u bytes)", (unsigned)coalesce_bytes);
+				}
+		}
+		#endif
+		
 		// Let driver set up hardware-specific LVGL configuration
 		driver->configureLVGL(display, DISPLAY_ROTATION);
 		
@@ -504,17 +1274,13 @@ void DisplayManager::init() {
 		
 		LOGI("Display", "Manager init start");
 		
-		// Create all screens
+		// Only the splash is built up front; registered screens are created
+		// by the LVGL task on their first show (ensureScreenCreated()).
 		splashScreen.create();
-		infoScreen.create();
-	testScreen.create();
-		fpsScreen.create();
-		#if HAS_TOUCH && LV_USE_CANVAS
-		touchTestScreen.create();
-		#endif
 
 		// Show splash immediately
 		showSplash();
+		publishScreenStats();
 		
 		// Create LVGL rendering task
 		// Stack size increased to 8KB for ESP32-S3 and larger displays
@@ -583,12 +1349,14 @@ void DisplayManager::showSplash() {
 void DisplayManager::showInfo() {
 		// Defer screen switch to lvglTask (non-blocking)
 		pendingScreen = &infoScreen;
+		wake();
 		LOGI("Display", "Queued switch to InfoScreen");
 }
 
 void DisplayManager::showTest() {
 		// Defer screen switch to lvglTask (non-blocking)
 		pendingScreen = &testScreen;
+		wake();
 		LOGI("Display", "Queued switch to TestScreen");
 }
 
@@ -607,6 +1375,7 @@ void DisplayManager::setSplashStatus(const char* text) {
 		strlcpy(pendingSplashStatus, text ? text : "", sizeof(pendingSplashStatus));
 		pendingSplashStatusSet = true;
 		portEXIT_CRITICAL(&g_splash_status_mux);
+		wake();
 }
 
 bool DisplayManager::showScreen(const char* screen_id) {
@@ -617,6 +1386,7 @@ bool DisplayManager::showScreen(const char* screen_id) {
 				if (strcmp(availableScreens[i].id, screen_id) == 0) {
 						// Defer screen switch to lvglTask (non-blocking)
 						pendingScreen = availableScreens[i].instance;
+						wake();
 						LOGI("Display", "Queued switch to screen: %s", screen_id);
 						return true;
 				}
@@ -626,6 +1396,23 @@ bool DisplayManager::showScreen(const char* screen_id) {
 		return false;
 }
 
+bool DisplayManager::prewarmScreen(const char* screen_id) {
+		if (!screen_id) return false;
+
+		for (size_t i = 0; i < screenCount; i++) {
+				if (strcmp(availableScreens[i].id, screen_id) == 0) {
+						// Defer to lvglTask (built after any pending switch is rendered)
+						pendingWarm = availableScreens[i].instance;
+						wake();
+						LOGI("Display", "Queued pre-warm of screen: %s", screen_id);
+						return true;
+				}
+		}
+
+		LOGW("Display", "Screen not found: %s", screen_id);
+		return false;
+}
+
 const char* DisplayManager::getCurrentScreenId() {
 		// Return ID of current screen (nullptr if splash or unknown)
 		for (size_t i = 0; i < screenCount; i++) {
@@ -636,11 +1423,178 @@ const char* DisplayManager::getCurrentScreenId() {
 		return nullptr;  // Splash or unknown screen
 }
 
+bool DisplayManager::registerScreen(const char* id, const char* display_name, Screen* screen) {
+		if (!id || !screen) return false;
+		if (lvglTaskHandle) {
+				LOGW("Display", "registerScreen(%s) after init() ignored", id);
+				return false;
+		}
+		for (size_t i = 0; i < screenCount; i++) {
+				if (strcmp(availableScreens[i].id, id) == 0) {
+						LOGW("Display", "Screen already registered: %s", id);
+						return false;
+				}
+		}
+
+		if (screenCount == screenCapacity) {
+				const size_t newCapacity = screenCapacity ? screenCapacity * 2 : 8;
+				ScreenInfo* screens = (ScreenInfo*)realloc(availableScreens, newCapacity * sizeof(ScreenInfo));
+				if (!screens) {
+						LOGE("Display", "Screen registry full (%u), dropping %s", (unsigned)screenCount, id);
+						return false;
+				}
+				availableScreens = screens;
+				ScreenSlot* slots = (ScreenSlot*)realloc(screenSlots, newCapacity * sizeof(ScreenSlot));
+				if (!slots) {
+						LOGE("Display", "Screen registry full (%u), dropping %s", (unsigned)screenCount, id);
+						return false;
+				}
+				screenSlots = slots;
+				screenCapacity = newCapacity;
+		}
+
+		availableScreens[screenCount] = {id, display_name, screen};
+		screenSlots[screenCount] = {};
+		screenCount++;
+		return true;
+}
+
 const ScreenInfo* DisplayManager::getAvailableScreens(size_t* count) {
 		if (count) *count = screenCount;
 		return availableScreens;
 }
 
+int DisplayManager::findScreenSlot(const Screen* screen) const {
+		if (!screen) return -1;
+		for (size_t i = 0; i < screenCount; i++) {
+				if (availableScreens[i].instance == screen) return (int)i;
+		}
+		return -1;
+}
+
+void DisplayManager::ensureScreenCreated(Screen* screen) {
+		const int slot = findScreenSlot(screen);
+		if (slot < 0 || screenSlots[slot].created) return;
+
+		// The LVGL mutex is held and the draw units are idle between passes,
+		// so the heap growth across create() is this screen's widget tree.
+		size_t psramBefore = 0, internalBefore = 0;
+		lvgl_heap_get_usage(&psramBefore, &internalBefore);
+		const uint64_t start_us = esp_timer_get_time();
+		screen->create();
+		const uint32_t create_us = (uint32_t)(esp_timer_get_time() - start_us);
+		size_t psramAfter = 0, internalAfter = 0;
+		lvgl_heap_get_usage(&psramAfter, &internalAfter);
+
+		ScreenSlot& s = screenSlots[slot];
+		s.created = true;
+		s.psramBytes = psramAfter > psramBefore ? (uint32_t)(psramAfter - psramBefore) : 0;
+		s.internalBytes = internalAfter > internalBefore ? (uint32_t)(internalAfter - internalBefore) : 0;
+		screenCreates++;
+
+		LOGI("Display", "Created %s: %u B PSRAM, %u B internal (%u us)",
+				 availableScreens[slot].id, (unsigned)s.psramBytes, (unsigned)s.internalBytes, (unsigned)create_us);
+}
+
+void DisplayManager::enforceScreenBudget() {
+		const uint32_t psramBudget = DISPLAY_SCREEN_BUDGET_PSRAM;
+		const uint32_t internalBudget = DISPLAY_SCREEN_BUDGET_INTERNAL;
+		const uint32_t maxResident = DISPLAY_SCREEN_MAX_RESIDENT;
+		if (psramBudget == 0 && internalBudget == 0 && maxResident == 0) return;
+
+		while (true) {
+				uint32_t psram = 0, internal = 0, resident = 0;
+				for (size_t i = 0; i < screenCount; i++) {
+						if (!screenSlots[i].created) continue;
+						psram += screenSlots[i].psramBytes;
+						internal += screenSlots[i].internalBytes;
+						resident++;
+				}
+				const bool overPsram = psramBudget > 0 && psram > psramBudget;
+				const bool overInternal = internalBudget > 0 && internal > internalBudget;
+				const bool overCount = maxResident > 0 && resident > maxResident;
+				if (!overPsram && !overInternal && !overCount) return;
+
+				// Least recently shown screen that frees memory in an exceeded region
+				// (any resident screen counts when only the resident cap is exceeded).
+				int lru = -1;
+				for (size_t i = 0; i < screenCount; i++) {
+						const ScreenSlot& s = screenSlots[i];
+						if (!s.created || availableScreens[i].instance == currentScreen) continue;
+						if (!overCount && !(overPsram && s.psramBytes) && !(overInternal && s.internalBytes)) continue;
+						if (lru < 0 || (int32_t)(s.lastShownMs - screenSlots[lru].lastShownMs) < 0) {
+								lru = (int)i;
+						}
+				}
+				if (lru < 0) {
+						// Whatever is left (at least the current screen) stays until the next switch.
+						LOGW("Display", "Screen budget still exceeded, nothing to evict (%u screens, %u B PSRAM, %u B internal)",
+								 (unsigned)resident, (unsigned)psram, (unsigned)internal);
+						return;
+				}
+
+				availableScreens[lru].instance->destroy();
+				screenSlots[lru].created = false;
+				screenEvictions++;
+				LOGI("Display", "Evicted %s (%u B PSRAM, %u B internal)",
+						 availableScreens[lru].id, (unsigned)screenSlots[lru].psramBytes, (unsigned)screenSlots[lru].internalBytes);
+		}
+}
+
+void DisplayManager::warmScreen(Screen* screen) {
+		const int slot = findScreenSlot(screen);
+		if (slot < 0 || screen == currentScreen) return;
+
+		const uint64_t start_us = esp_timer_get_time();
+		ensureScreenCreated(screen);
+		// Styles, text metrics and positions are resolved lazily by LVGL; do it
+		// now so the switch frame only has to draw.
+		lv_obj_t* root = screen->root();
+		if (root) {
+				lv_obj_update_layout(root);
+		}
+		const uint32_t warm_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+		// Counts as recently used, so the budget check evicts something else first.
+		screenSlots[slot].lastShownMs = millis();
+		screenPrewarms++;
+		LOGI("Display", "Pre-warmed %s (%u us)", availableScreens[slot].id, (unsigned)warm_us);
+
+		enforceScreenBudget();
+		publishScreenStats();
+}
+
+Screen* DisplayManager::predictNextScreen() const {
+		if (screenCount == 0) return nullptr;
+		const int cur = findScreenSlot(currentScreen);
+		// From the splash (unregistered), the first registered screen is next.
+		const size_t start = cur < 0 ? 0 : (size_t)cur + 1;
+		for (size_t k = 0; k < screenCount; k++) {
+				const size_t i = (start + k) % screenCount;
+				if ((int)i == cur) continue;
+				if (!screenSlots[i].created) return availableScreens[i].instance;
+		}
+		return nullptr;
+}
+
+void DisplayManager::publishScreenStats() {
+		DisplayScreenStats stats = {};
+		for (size_t i = 0; i < screenCount; i++) {
+				if (!screenSlots[i].created) continue;
+				stats.resident++;
+				stats.psram_bytes += screenSlots[i].psramBytes;
+				stats.internal_bytes += screenSlots[i].internalBytes;
+		}
+		stats.creates = screenCreates;
+		stats.evictions = screenEvictions;
+		stats.prewarms = screenPrewarms;
+
+		portENTER_CRITICAL(&g_perf_mux);
+		g_screen_stats = stats;
+		g_screen_stats_ready = true;
+		portEXIT_CRITICAL(&g_perf_mux);
+}
+
 // C-style interface for app.ino
 void display_manager_init(DeviceConfig* config) {
 		if (!displayManager) {
@@ -681,6 +1635,13 @@ void display_manager_show_screen(const char* screen_id, bool* success) {
 		if (success) *success = result;
 }
 
+bool display_manager_prewarm_screen(const char* screen_id) {
+		if (displayManager) {
+				return displayManager->prewarmScreen(screen_id);
+		}
+		return false;
+}
+
 const char* display_manager_get_current_screen_id() {
 		if (displayManager) {
 				return displayManager->getCurrentScreenId();
@@ -729,4 +1690,16 @@ bool display_manager_try_lock(uint32_t timeout_ms) {
 		return displayManager->tryLock(timeout_ms);
 }
 
+void display_manager_wake() {
+		if (displayManager) {
+				displayManager->wake();
+		}
+}
+
+void display_manager_set_render_sleep(bool sleep) {
+		if (displayManager) {
+				displayManager->setRenderSleep(sleep);
+		}
+}
+
 #endif // HAS_DISPLAY
@@ -19,15 +19,11 @@
 #include <freertos/task.h>
 #include <freertos/semphr.h>
 #include "rtos_task_utils.h"
+#include "perf_histogram.h"
 
 // ============================================================================
 // Screen Registry
 // ============================================================================
-// Maximum number of screens that can be registered for runtime navigation
-// Generous headroom (8 slots) allows adding new screens without recompiling
-// Only ~192 bytes total (24 bytes × 8), negligible overhead vs heap allocation
-#define MAX_SCREENS 8
-
 // Struct for registering available screens dynamically
 struct ScreenInfo {
 		const char* id;            // Unique identifier (e.g., "info", "test")
@@ -76,6 +72,8 @@ private:
 		Screen* currentScreen;
 		Screen* previousScreen;  // Track previous screen for return navigation
 		Screen* pendingScreen;   // Deferred screen switch (processed in lvglTask)
+		Screen* pendingWarm;     // Deferred pre-warm request (prewarmScreen())
+		bool warmArmed;          // DISPLAY_SCREEN_PREWARM: predict + warm after the next rendered switch
 
 		// Defer small LVGL UI updates (like splash status) to the LVGL task.
 		char pendingSplashStatus[96];
@@ -86,21 +84,53 @@ private:
 		void lockIfNeeded(bool& didLock);
 		void unlockIfNeeded(bool didLock);
 		
-		// Screen instances (created at init, kept in memory)
+		// Screen instances.  Splash is created at init; registered screens are
+		// created on first show and may be destroyed again under a memory budget.
 		SplashScreen splashScreen;
 		InfoScreen infoScreen;
 		TestScreen testScreen;
 		FpsScreen fpsScreen;
+		FpsScreen fpsComplexScreen;
 		
 		#if HAS_TOUCH && LV_USE_CANVAS
 		TouchTestScreen touchTestScreen;
 		#endif
 		
-		// Screen registry for runtime navigation (static allocation, no heap)
-		// screenCount tracks how many slots are actually used (currently 2: info, test)
+		// Screen registry for runtime navigation, grown by registerScreen().
+		// Its size is independent of how many screens may be resident at once
+		// (DISPLAY_SCREEN_MAX_RESIDENT and the memory budgets).
 		// Splash excluded from runtime selection (boot-specific only)
-		ScreenInfo availableScreens[MAX_SCREENS];
+		ScreenInfo* availableScreens;
 		size_t screenCount;
+		size_t screenCapacity;
+
+		// Lifecycle state per registered screen (parallel to availableScreens).
+		// Only touched from the LVGL task (under the LVGL mutex).
+		struct ScreenSlot {
+				bool created;
+				uint32_t lastShownMs;
+				uint32_t psramBytes;     // LVGL heap growth measured across create()
+				uint32_t internalBytes;
+		};
+		ScreenSlot* screenSlots;  // screenCapacity entries
+		uint32_t screenCreates;
+		uint32_t screenEvictions;
+		uint32_t screenPrewarms;
+
+		// Create a registered screen on first use and record its footprint.
+		void ensureScreenCreated(Screen* screen);
+		// Destroy least recently shown screens (never the current one) until the
+		// resident footprint fits DISPLAY_SCREEN_BUDGET_PSRAM / _INTERNAL and
+		// the resident count fits DISPLAY_SCREEN_MAX_RESIDENT.
+		void enforceScreenBudget();
+		void publishScreenStats();
+		int findScreenSlot(const Screen* screen) const;
+
+		// Create a screen ahead of its switch and resolve its layout.
+		void warmScreen(Screen* screen);
+		// DISPLAY_SCREEN_PREWARM guess: next registered screen (after the
+		// current one) that is not created yet; nullptr when all are.
+		Screen* predictNextScreen() const;
 
 		// Internal helper: map a Screen instance to its logical screen id.
 		// Uses the registered screen list so adding new screens doesn't require
@@ -114,10 +144,37 @@ private:
 		// LVGL flush callback (static, accesses instance via user_data)
 		static void flushCallback(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
 
+		// One driver transaction (startWrite/setAddrWindow/pushColors/endWrite).
+		void pushArea(int32_t x, int32_t y, uint32_t w, uint32_t h, uint16_t* pixels, uint32_t strideBytes);
+
+		// Flush-area coalescing (DISPLAY_FLUSH_COALESCE; Direct, synchronous drivers).
+		// Small areas (<= DISPLAY_FLUSH_COALESCE_MAX_AREA_PX, where bus setup
+		// dominates) are staged into coalesceBuf; vertically adjacent ones with
+		// the same x-span join one transaction. Larger areas, and the last area
+		// of a refresh with nothing staged, are sent in place.
+		uint16_t* coalesceBuf;
+		uint32_t coalesceCapacityPx;
+		bool coalescePending;
+		lv_area_t coalesceArea;
+		void coalesceStage(const lv_area_t* area, const uint8_t* px_map, uint32_t strideBytes, bool last);
+		void coalesceFlush();
+
 		// Buffered render-mode drivers (e.g., Arduino_GFX canvas) need an explicit
 		// present() step, but only after LVGL has actually rendered something.
 		bool flushPending;
 
+		// A rendered frame is waiting to be handed to the present task
+		// (deferred while a double-buffered driver's front buffer is busy).
+		bool presentPending;
+
+		// Render-off (screen saver asleep): requested by setRenderSleep(),
+		// applied by the LVGL task once no frame is in flight.
+		volatile bool renderSleepRequested;
+		bool renderAsleep;       // LVGL task only: lv_timer_handler() and transfers suspended
+		bool panelAsleep;        // Panel controller put into sleep-in (DISPLAY_SLEEP_PANEL)
+		void enterRenderSleep();
+		void exitRenderSleep();
+
 		// FreeRTOS task for LVGL rendering
 		static void lvglTask(void* pvParameter);
 		
@@ -138,10 +195,19 @@ public:
 		
 		// Screen selection by ID (thread-safe, returns true if found)
 		bool showScreen(const char* screen_id);
+
+		// Build a screen ahead of time so a later showScreen() only has to render it
+		// (thread-safe, deferred to the LVGL task; returns true if found).
+		bool prewarmScreen(const char* screen_id);
 		
 		// Get current screen ID (returns nullptr if splash or no screen)
 		const char* getCurrentScreenId();
 		
+		// Add a screen to the runtime registry. Call before init(); the LVGL task
+		// walks the registry without a lock. Returns false on a duplicate id,
+		// after init(), or when the registry cannot grow.
+		bool registerScreen(const char* id, const char* display_name, Screen* screen);
+
 		// Get available screens for runtime navigation
 		const ScreenInfo* getAvailableScreens(size_t* count);
 		
@@ -156,6 +222,16 @@ public:
 		// Returns true if the lock was acquired.
 		bool tryLock(uint32_t timeoutMs);
 
+		// Wake the LVGL task out of its idle wait (LVGL_IDLE_SCHEDULER; no-op otherwise).
+		// Called automatically on screen switches, splash updates and unlock() from
+		// other tasks; call it after changing state that a Screen::update() reads.
+		void wake();
+
+		// Suspend rendering and panel transfers (and with DISPLAY_SLEEP_PANEL, put
+		// the panel to sleep) while the backlight is off; resuming redraws the
+		// whole screen. Thread-safe, applied by the LVGL task.
+		void setRenderSleep(bool sleep);
+
 		// Active LVGL logical resolution (post driver->configureLVGL()).
 		// Prefer using these instead of calling LVGL APIs from non-LVGL tasks.
 	int getActiveWidth() const;
@@ -171,6 +247,94 @@ struct DisplayPerfStats {
 		uint16_t fps;
 		uint32_t lv_timer_us;
 		uint32_t present_us;
+		uint32_t bytes_per_frame;  // Avg bytes sent to the panel per frame (last ~1s window)
+		uint32_t flush_areas;         // LVGL flush areas in the last ~1s window
+		uint32_t flush_transactions;  // Driver transactions issued for them (< areas when coalescing)
+		uint32_t flush_staged;        // DISPLAY_FLUSH_COALESCE: areas copied into the staging buffer
+		uint32_t flush_merged;        // ... of which joined a staged run (one transaction saved each)
+		uint32_t rows_hashed;         // DISPLAY_ROW_HASH: dirty rows hashed by present() (last ~1s window)
+		uint32_t rows_skipped;        // ... of which unchanged and not sent
+		uint32_t row_hash_us;         // ... total time spent hashing
+
+		// Duration distributions over the last completed DISPLAY_PERF_HIST_WINDOW_MS window
+		// (count == 0 when nothing was recorded, e.g. present on Direct drivers).
+		PerfPercentiles lv_timer_pct;  // lv_timer_handler() per frame with draw data
+		PerfPercentiles flush_pct;     // One driver transaction in flushCallback()
+		PerfPercentiles present_pct;   // present() (Buffered drivers)
+
+		// LVGL task time split over the last ~1s (published even when nothing is drawn).
+		uint8_t lvgl_busy_pct;  // Locked pass: lv_timer_handler() + Screen::update() + flush
+		uint8_t lvgl_idle_pct;  // Parked in the idle wait (LVGL_IDLE_SCHEDULER); rest is short sleeps
+
+		// Latest screen switch, from the LVGL task picking it up to its first
+		// frame reaching the panel (0 until the first switch).
+		uint32_t switch_us;
+		bool switch_warm;       // Target already existed (resident or pre-warmed)
+};
+
+// Registered-screen residency (lazy create + budgeted eviction).
+struct DisplayScreenStats {
+		uint16_t resident;        // Registered screens with a live LVGL tree
+		uint32_t psram_bytes;     // Their summed create() footprint in PSRAM
+		uint32_t internal_bytes;  // ... and in internal RAM
+		uint32_t creates;         // create() calls since boot (first shows + re-creates)
+		uint32_t evictions;       // Screens destroyed to stay within budget
+		uint32_t prewarms;        // Screens built ahead of their switch
+};
+
+// Render-off while the screen saver is asleep (DISPLAY_SLEEP_RENDER_OFF).
+// Savings are estimated from the awake averages since boot: nothing runs
+// while asleep, so there is nothing to measure directly.
+struct DisplaySleepStats {
+		bool asleep;              // Rendering suspended right now
+		bool panel_sleep;         // ... and the panel controller is in sleep-in
+		uint32_t sleeps;          // Suspends since boot
+		uint32_t asleep_ms;       // Total time suspended, including the current sleep
+		uint32_t cpu_saved_ms;    // Awake LVGL-task busy share x asleep time
+		uint32_t frames_skipped;  // Awake frame rate x asleep time
+		uint32_t kb_skipped;      // Awake panel bytes/s x asleep time
+		uint32_t saved_mah;       // DISPLAY_SLEEP_SAVED_MA x asleep time (0 when unset)
+};
+
+// Touch-to-photon latency since boot or the last reset: capture of a press to
+// the first frame flushed after LVGL read it, and to that frame's present().
+struct DisplayInputLatency {
+		PerfPercentiles touch_flush;    // Capture -> first flush (us)
+		PerfPercentiles touch_present;  // Capture -> that frame reached the panel (us)
+		uint32_t presses;               // Presses marked (including unmatched)
+		uint32_t unmatched;             // Presses with no frame within DISPLAY_INPUT_LATENCY_MAX_MS
+		uint32_t last_flush_us;         // Most recent press (0 = none yet)
+		uint32_t last_present_us;
+};
+
+// Async SPI DMA flush (TFT_ESPI_DMA_FLUSH) since boot.
+struct DisplayFlushDmaStats {
+		uint32_t transfers;   // Flush strips sent by DMA
+		uint32_t waits;       // ... still on the wire when LVGL needed the buffer back
+		uint8_t overlap_pct;  // Share of wire time hidden behind rendering
+		uint32_t stall_ms;    // LVGL task time blocked waiting for DMA
+};
+
+// Frame benchmark accumulator (see display_benchmark.h).
+// Min/max/sum per metric over one measurement window, plus percentiles for
+// the frame timings.
+struct DisplayBenchStats {
+		uint32_t window_ms;
+		uint32_t frames;            // LVGL passes that produced draw data
+		uint32_t flushes;           // flushCallback() invocations
+		uint32_t transactions;      // Driver transactions (after coalescing)
+		uint64_t flush_pixels;      // Total pixels across all flushes
+		uint32_t flush_pixels_min;
+		uint32_t flush_pixels_max;
+		uint64_t lv_timer_us_sum;
+		uint32_t lv_timer_us_min;
+		uint32_t lv_timer_us_max;
+		uint32_t presents;          // present() calls (Buffered drivers only)
+		uint64_t present_us_sum;
+		uint32_t present_us_min;
+		uint32_t present_us_max;
+		PerfPercentiles lv_timer_pct;  // Filled by display_manager_bench_end()
+		PerfPercentiles present_pct;
 };
 
 // Global instance (managed by app.ino)
@@ -182,6 +346,7 @@ void display_manager_show_splash();
 void display_manager_show_info();
 void display_manager_show_test();
 void display_manager_show_screen(const char* screen_id, bool* success);  // success is optional output
+bool display_manager_prewarm_screen(const char* screen_id);
 const char* display_manager_get_current_screen_id();
 const ScreenInfo* display_manager_get_available_screens(size_t* count);
 void display_manager_set_splash_status(const char* text);
@@ -193,8 +358,37 @@ void display_manager_lock();
 void display_manager_unlock();
 bool display_manager_try_lock(uint32_t timeout_ms);
 
+// Wake the LVGL render task if the idle scheduler has parked it.
+void display_manager_wake();
+
+// Render-off while the backlight is off (see DisplayManager::setRenderSleep()).
+void display_manager_set_render_sleep(bool sleep);
+
 // Best-effort perf stats for diagnostics (/api/health).
 // Returns false until a first stats window has been captured.
 bool display_manager_get_perf_stats(DisplayPerfStats* out);
 
+// Screen residency/footprint counters (see DisplayScreenStats).
+bool display_manager_get_screen_stats(DisplayScreenStats* out);
+
+// Render-off counters and savings estimates (see DisplaySleepStats).
+// Returns false until the LVGL task has started.
+bool display_manager_get_sleep_stats(DisplaySleepStats* out);
+
+// DMA flush overlap (see DisplayFlushDmaStats). Returns false when the
+// driver does not flush by DMA.
+bool display_manager_get_flush_dma_stats(DisplayFlushDmaStats* out);
+
+// Touch-to-photon latency. mark_input() is called from the LVGL indev read
+// callback (LVGL task) with the capture time of a new press, in the low
+// 32 bits of esp_timer_get_time().
+void display_manager_mark_input(uint32_t capture_us);
+bool display_manager_get_input_latency(DisplayInputLatency* out);
+void display_manager_reset_input_latency();
+
+// Frame benchmark window: begin() resets and starts accumulating,
+// end() stops and copies the window. Returns false if no window was open.
+void display_manager_bench_begin();
+bool display_manager_bench_end(DisplayBenchStats* out);
+
 #endif // DISPLAY_MANAGER_H
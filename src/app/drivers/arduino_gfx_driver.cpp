@@ -9,22 +9,27 @@
  */
 
 #include "arduino_gfx_driver.h"
+#include "rgb565_rotate.h"
 #include "../log_manager.h"
 #include <esp_heap_caps.h>
+#include <esp_timer.h>
 
-// Spinlock protecting dirtyMaxRow / hasDirtyRows shared between
-// pushColors() (LVGL task) and present() (async present task).
+// Spinlock protecting dirtyBands / presentBands / frontBusy shared between
+// pushColors()/commitFrame() (LVGL task) and present() (async present task).
 static portMUX_TYPE s_dirty_mux = portMUX_INITIALIZER_UNLOCKED;
 
 Arduino_GFX_Driver::Arduino_GFX_Driver() 
 		: bus(nullptr), gfx(nullptr), currentBrightness(100), backlightPwmAttached(false),
 			displayWidth(DISPLAY_WIDTH), displayHeight(DISPLAY_HEIGHT), displayRotation(DISPLAY_ROTATION),
 			currentX(0), currentY(0), currentW(0), currentH(0),
-			framebuffer(nullptr), hasDirtyRows(false), dirtyMaxRow(0) {
+			framebuffer(nullptr), frontBuffer(nullptr), dirtyBands{}, presentBands{}, frontBusy(false),
+			lastPresentedBytes(0), rowHashes(nullptr), lastRowHash{} {
 }
 
 Arduino_GFX_Driver::~Arduino_GFX_Driver() {
 		if (framebuffer) { heap_caps_free(framebuffer); framebuffer = nullptr; }
+		if (frontBuffer) { heap_caps_free(frontBuffer); frontBuffer = nullptr; }
+		if (rowHashes) { heap_caps_free(rowHashes); rowHashes = nullptr; }
 		if (gfx) delete gfx;
 		if (bus) delete bus;
 }
@@ -40,10 +45,12 @@ void Arduino_GFX_Driver::init() {
 		// Configure PWM for smooth brightness control
 		#if ESP_ARDUINO_VERSION_MAJOR >= 3
 		double actualFreq = ledcAttach(LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, 8);  // pin, freq, resolution (8-bit)
+		backlightFader.begin(LCD_BL_PIN);
 		LOGI("GFX", "PWM attached on GPIO%d, actual freq: %.1f Hz", LCD_BL_PIN, actualFreq);
 		#else
 		ledcSetup(TFT_BACKLIGHT_PWM_CHANNEL, TFT_BACKLIGHT_PWM_FREQ, 8);
 		ledcAttachPin(LCD_BL_PIN, TFT_BACKLIGHT_PWM_CHANNEL);
+		backlightFader.begin(TFT_BACKLIGHT_PWM_CHANNEL);
 		LOGI("GFX", "PWM setup complete on GPIO%d (channel %d)", LCD_BL_PIN, TFT_BACKLIGHT_PWM_CHANNEL);
 		#endif
 		backlightPwmAttached = true;
@@ -109,6 +116,34 @@ void Arduino_GFX_Driver::init() {
 				LOGE("GFX", "Failed to allocate framebuffer! (%u bytes)", fbBytes);
 		}
 		
+		#if DISPLAY_DOUBLE_BUFFER
+		// Second framebuffer for tear-free present (PSRAM only — two full frames
+		// would exhaust internal RAM).  Single buffering remains if this fails.
+		if (framebuffer) {
+				frontBuffer = (uint16_t*)heap_caps_malloc(fbBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+				if (frontBuffer) {
+						memset(frontBuffer, 0, fbBytes);
+						LOGI("GFX", "Double buffering enabled (second framebuffer %u bytes)", fbBytes);
+				} else {
+						LOGW("GFX", "Double buffering disabled: second framebuffer alloc failed (%u bytes)", fbBytes);
+				}
+		}
+		#endif
+		
+		#if DISPLAY_ROW_HASH
+		// One hash per portrait row; zeroed = unknown, so the first frame is sent in full.
+		if (framebuffer) {
+				const size_t hashBytes = (size_t)displayHeight * sizeof(uint32_t);
+				rowHashes = (uint32_t*)heap_caps_malloc(hashBytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+				if (rowHashes) {
+						row_hash_reset(rowHashes, displayHeight);
+						LOGI("GFX", "Row hashing enabled (%u bytes)", (unsigned)hashBytes);
+				} else {
+						LOGW("GFX", "Row hashing disabled: alloc failed (%u bytes)", (unsigned)hashBytes);
+				}
+		}
+		#endif
+		
 		LOGI("GFX", "Display ready: %dx%d (physical), rotation %d", displayWidth, displayHeight, displayRotation);
 }
 
@@ -153,6 +188,7 @@ void Arduino_GFX_Driver::setBacklight(bool on) {
 }
 
 void Arduino_GFX_Driver::setBacklightBrightness(uint8_t brightness) {
+		backlightFader.cancel();  // A direct write ends any running fade
 		#ifdef LCD_BL_PIN
 		if (brightness > 100) brightness = 100;
 		currentBrightness = brightness;
@@ -188,6 +224,7 @@ void Arduino_GFX_Driver::setBacklightBrightness(uint8_t brightness) {
 }
 
 uint8_t Arduino_GFX_Driver::getBacklightBrightness() {
+		if (backlightFader.active()) return backlightFader.brightness();
 		return currentBrightness;
 }
 
@@ -199,6 +236,36 @@ bool Arduino_GFX_Driver::hasBacklightControl() {
 		#endif
 }
 
+bool Arduino_GFX_Driver::fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) {
+		#if defined(LCD_BL_PIN) && HAS_BACKLIGHT && BACKLIGHT_FADE_ENGINE
+		if (to > 100) to = 100;
+		if (!backlightFader.start(from, to, duration_ms)) return false;
+		currentBrightness = to;
+		return true;
+		#else
+		return false;
+		#endif
+}
+
+bool Arduino_GFX_Driver::backlightFading() const {
+		return backlightFader.active();
+}
+
+bool Arduino_GFX_Driver::setPanelSleep(bool sleep) {
+		if (!gfx) return false;
+		Arduino_AXS15231B* panel = static_cast<Arduino_AXS15231B*>(gfx);
+		if (sleep) {
+				panel->displayOff();
+		} else {
+				panel->displayOn();
+		}
+		if (!sleep && rowHashes) {
+				// The panel may not have kept what the hashes say was sent.
+				row_hash_reset(rowHashes, displayHeight);
+		}
+		return true;
+}
+
 void Arduino_GFX_Driver::applyDisplayFixes() {
 		// AXS15231B doesn't need gamma correction or inversion fixes
 		// Panel is configured correctly by Arduino_GFX library
@@ -232,93 +299,134 @@ void Arduino_GFX_Driver::pushColors(uint16_t* data, uint32_t len, bool swap_byte
 		
 		// Copy LVGL flush strip into the portrait framebuffer.
 		// For rotation 0 the coordinates map 1:1; for landscape rotations
-		// each pixel is transposed from logical to physical orientation.
+		// each pixel is transposed from logical to physical orientation
+		// (tiled kernel, see rgb565_rotate.h).
 		// Track the portrait row range touched for dirty-row optimisation.
+		const uint32_t srcStridePx = flushSrcStride ? (flushSrcStride / sizeof(uint16_t)) : w;
+		rgb565_rotate_blit(framebuffer, displayWidth, displayHeight, data, srcStridePx, x, y, w, h, displayRotation);
 		
-		// Compute the furthest dirty portrait row for this strip.
-		uint16_t maxDirtyRow = 0;
-		
+		// Portrait row range touched by this strip.
+		uint16_t firstRow = 0, lastRow = 0;
 		switch (displayRotation) {
-				case 0: {
-						// Portrait — direct row-by-row memcpy.
-						maxDirtyRow = (uint16_t)(y + h - 1);
-						for (uint16_t r = 0; r < h; r++) {
-								memcpy(&framebuffer[(y + r) * displayWidth + x],
-											 &data[r * w],
-											 w * sizeof(uint16_t));
-						}
-						break;
-				}
-				case 1: {
-						// 90° CW — logical (lx, ly) → physical (ly, H-1-lx)
-						maxDirtyRow = displayHeight - 1 - x;
-						for (uint16_t r = 0; r < h; r++) {
-								const uint16_t py_base = y + r;
-								for (uint16_t c = 0; c < w; c++) {
-										const uint16_t px = py_base;
-										const uint16_t py = displayHeight - 1 - (x + c);
-										framebuffer[py * displayWidth + px] = data[r * w + c];
-								}
-						}
-						break;
-				}
-				case 2: {
-						// 180° — logical (lx, ly) → physical (W-1-lx, H-1-ly)
-						maxDirtyRow = displayHeight - 1 - y;
-						for (uint16_t r = 0; r < h; r++) {
-								const uint16_t py = displayHeight - 1 - (y + r);
-								for (uint16_t c = 0; c < w; c++) {
-										const uint16_t px = displayWidth - 1 - (x + c);
-										framebuffer[py * displayWidth + px] = data[r * w + c];
-								}
-						}
-						break;
-				}
-				case 3: {
-						// 270° CW — logical (lx, ly) → physical (W-1-ly, lx)
-						maxDirtyRow = (uint16_t)(x + w - 1);
-						for (uint16_t r = 0; r < h; r++) {
-								for (uint16_t c = 0; c < w; c++) {
-										const uint16_t px = displayWidth - 1 - (y + r);
-										const uint16_t py = x + c;
-										framebuffer[py * displayWidth + px] = data[r * w + c];
-								}
-						}
-						break;
-				}
+				case 0: firstRow = y;                      lastRow = y + h - 1;             break;  // (lx, ly) → (lx, ly)
+				case 1: firstRow = displayHeight - (x + w); lastRow = displayHeight - 1 - x; break;  // (lx, ly) → (ly, H-1-lx)
+				case 2: firstRow = displayHeight - (y + h); lastRow = displayHeight - 1 - y; break;  // (lx, ly) → (W-1-lx, H-1-ly)
+				case 3: firstRow = x;                      lastRow = x + w - 1;             break;  // (lx, ly) → (W-1-ly, lx)
 		}
 		
-		// Atomic dirty-row update — safe for concurrent present() in the async
-		// present task (only the tracking variables are shared, not the framebuffer
-		// writes above which are harmless to overlap with the QSPI read path).
+		// Atomic dirty-band update — safe for concurrent present() in the async
+		// present task.  In single-buffer mode the framebuffer writes above can
+		// overlap the QSPI read path (possible one-frame tear); double-buffer mode
+		// writes only the back buffer.
 		portENTER_CRITICAL(&s_dirty_mux);
-		hasDirtyRows = true;
-		if (maxDirtyRow > dirtyMaxRow) dirtyMaxRow = maxDirtyRow;
+		dirtyBands.add(firstRow, lastRow);
+		portEXIT_CRITICAL(&s_dirty_mux);
+}
+
+bool Arduino_GFX_Driver::commitFrame() {
+		if (!frontBuffer) return true;  // Single buffer: present() reads the live framebuffer.
+		
+		// Swap only once present() has released the front buffer; otherwise keep
+		// drawing into the back buffer and let DisplayManager retry.
+		portENTER_CRITICAL(&s_dirty_mux);
+		if (frontBusy) {
+				portEXIT_CRITICAL(&s_dirty_mux);
+				return false;
+		}
+		const DirtyRowBands bands = dirtyBands;
+		dirtyBands.clear();
+		uint16_t* finished = framebuffer;
+		framebuffer = frontBuffer;
+		frontBuffer = finished;
+		presentBands = bands;
+		frontBusy = true;
 		portEXIT_CRITICAL(&s_dirty_mux);
+		
+		// Copy-forward: the new back buffer holds the previous frame, so it only
+		// differs from the new front in this frame's dirty bands.  present() only
+		// reads the front buffer, so this is safe to overlap with the transfer.
+		const size_t rowPixels = displayWidth;
+		for (uint8_t i = 0; i < bands.count; i++) {
+				const uint16_t first = bands.bands[i].first;
+				uint16_t last = bands.bands[i].last;
+				if (first >= displayHeight) continue;
+				if (last >= displayHeight) last = displayHeight - 1;
+				memcpy(&framebuffer[first * rowPixels],
+							 &frontBuffer[first * rowPixels],
+							 (size_t)(last - first + 1) * rowPixels * sizeof(uint16_t));
+		}
+		return true;
 }
 
 void Arduino_GFX_Driver::present() {
 		if (!gfx || !framebuffer) return;
 		
-		// Atomically capture and reset dirty-row state.
+		// Atomically capture and reset dirty-band state.
 		// This allows pushColors() in the LVGL task to safely update
 		// dirty tracking while present() transfers pixel data to the panel.
+		// Double-buffer mode sends the front buffer handed over by commitFrame().
+		DirtyRowBands bands;
+		const uint16_t* src;
 		portENTER_CRITICAL(&s_dirty_mux);
-		if (!hasDirtyRows) {
-				portEXIT_CRITICAL(&s_dirty_mux);
-				return;
+		if (frontBuffer) {
+				bands = presentBands;
+				presentBands.clear();
+				src = frontBuffer;
+		} else {
+				bands = dirtyBands;
+				dirtyBands.clear();
+				src = framebuffer;
 		}
-		uint16_t rowCount = dirtyMaxRow + 1;
-		hasDirtyRows = false;
-		dirtyMaxRow = 0;
 		portEXIT_CRITICAL(&s_dirty_mux);
 		
-		// Clamp to valid range.
-		if (rowCount > displayHeight) rowCount = displayHeight;
+		// Drop rows whose content is identical to what the panel already shows.
+		lastRowHash = RowHashStats{0, 0, 0};
+		if (rowHashes && !bands.empty()) {
+				const int64_t hashStart = esp_timer_get_time();
+				DirtyRowBands changed;
+				lastRowHash.rows_skipped = row_hash_filter(rowHashes, src, displayWidth, displayHeight,
+						bands, &changed, &lastRowHash.rows_hashed);
+				lastRowHash.hash_us = (uint32_t)(esp_timer_get_time() - hashStart);
+				bands = changed;
+		}
+		
+		if (bands.empty()) {
+				lastPresentedBytes = 0;
+		} else {
+				sendBands(src, bands);
+		}
+		
+		if (frontBuffer) {
+				portENTER_CRITICAL(&s_dirty_mux);
+				frontBusy = false;
+				portEXIT_CRITICAL(&s_dirty_mux);
+		}
+}
+
+void Arduino_GFX_Driver::sendBands(const uint16_t* src, const DirtyRowBands& bands) {
+		const uint32_t rowBytes = (uint32_t)displayWidth * sizeof(uint16_t);
 		
+		#if DISPLAY_PARTIAL_PRESENT
+		// Panel honours the address window: send each merged band in place.
+		uint32_t rowsSent = 0;
+		for (uint8_t i = 0; i < bands.count; i++) {
+				const uint16_t first = bands.bands[i].first;
+				uint16_t last = bands.bands[i].last;
+				if (first >= displayHeight) continue;
+				if (last >= displayHeight) last = displayHeight - 1;
+				const uint16_t rows = last - first + 1;
+				gfx->draw16bitRGBBitmap(0, first, const_cast<uint16_t*>(&src[(size_t)first * displayWidth]), displayWidth, rows);
+				rowsSent += rows;
+		}
+		lastPresentedBytes = rowsSent * rowBytes;
+		#else
 		// Send only the dirty portrait rows to the panel.
 		// draw16bitRGBBitmap at (0,0) works reliably on QSPI (see header).
 		// We always start at row 0 because the panel ignores address windows,
 		// but we limit the height to rowCount to reduce transfer size.
-		gfx->draw16bitRGBBitmap(0, 0, framebuffer, displayWidth, rowCount);
+		uint16_t rowCount = bands.maxRow() + 1;
+		if (rowCount > displayHeight) rowCount = displayHeight;
+		gfx->draw16bitRGBBitmap(0, 0, const_cast<uint16_t*>(src), displayWidth, rowCount);
+		lastPresentedBytes = rowCount * rowBytes;
+		#endif
 }
@@ -14,13 +14,37 @@
  *
  * Solution: keep a portrait-orientation PSRAM framebuffer.
  *   pushColors() copies (with optional rotation) each LVGL flush
- *   strip into the framebuffer and tracks which portrait rows were
- *   touched.  present() sends rows 0..maxDirtyRow to the panel
- *   via draw16bitRGBBitmap(0, 0, fb, w, dirtyRows) — starting at
- *   (0,0) which matches the panel's actual write position.
+ *   strip into the framebuffer and records the portrait rows it
+ *   touched as merged dirty bands (dirty_bands.h).
+ *   present() then either:
+ *     - DISPLAY_PARTIAL_PRESENT=false (default, AXS15231B QSPI):
+ *       sends rows 0..maxDirtyRow via draw16bitRGBBitmap(0, 0, ...)
+ *       — starting at (0,0) which matches the panel's actual write
+ *       position.  Only the max row matters here.
+ *     - DISPLAY_PARTIAL_PRESENT=true (panels that honour the address
+ *       window): sends each dirty band at its own row offset, so a
+ *       label at the bottom of the screen no longer re-sends the rows
+ *       above it.
  *   For partial redraws (widget animations, status updates) this
  *   transfers significantly less data than a full-frame flush.
  *
+ * Double buffering (DISPLAY_DOUBLE_BUFFER, opt-in):
+ *   With one framebuffer, the async present task reads rows that
+ *   pushColors() may be rewriting for the next frame, which tears
+ *   under load.  With two, pushColors() always writes the back buffer
+ *   and present() only reads the front one.  commitFrame() (LVGL task,
+ *   between frames) swaps them once the previous present() finished,
+ *   then copies the frame's dirty bands from the new front to the new
+ *   back so both stay identical outside the next frame's changes.
+ *   Costs a second PSRAM framebuffer; falls back to single buffering
+ *   if it cannot be allocated.
+ *
+ * Row hashing (DISPLAY_ROW_HASH, opt-in):
+ *   present() hashes each dirty row (row_hash.h) and drops rows whose
+ *   content matches what was last sent.  Skipped rows shrink the
+ *   transfer in partial mode; in the default full-prefix mode they only
+ *   help when they lower the max dirty row.
+ *
  * Compared with the former Arduino_Canvas approach this eliminates
  * the Canvas object (and its full GFX drawing API overhead) while
  * keeping the same reliable full-frame transfer.
@@ -31,6 +55,9 @@
 
 #include "../display_driver.h"
 #include "../board_config.h"
+#include "backlight_fader.h"
+#include "dirty_bands.h"
+#include "row_hash.h"
 #include <Arduino_GFX_Library.h>
 
 class Arduino_GFX_Driver : public DisplayDriver {
@@ -38,6 +65,7 @@ private:
 		Arduino_DataBus* bus;
 		Arduino_GFX* gfx;
 		uint8_t currentBrightness;  // Current brightness level (0-100%)
+		BacklightFader backlightFader;  // BACKLIGHT_FADE_ENGINE ramps
 		bool backlightPwmAttached;
 		uint16_t displayWidth;      // Physical panel width (portrait)
 		uint16_t displayHeight;     // Physical panel height (portrait)
@@ -48,13 +76,31 @@ private:
 		uint16_t currentW, currentH;
 		
 		// PSRAM framebuffer: portrait-orientation (displayWidth × displayHeight).
-		// pushColors() writes into this; present() sends it to the panel.
+		// pushColors() writes into this; present() sends it to the panel
+		// (single-buffer mode) — in double-buffer mode this is the back buffer.
 		uint16_t* framebuffer;
 		
-		// Dirty-row tracking: rows 0..dirtyMaxRow are sent in present(),
-		// skipping everything below the lowest dirty row.
-		bool hasDirtyRows;
-		uint16_t dirtyMaxRow;
+		// Double-buffer mode only: buffer being sent by present() (nullptr otherwise).
+		uint16_t* frontBuffer;
+		
+		// Portrait rows touched since the last present()/commitFrame() (merged bands).
+		DirtyRowBands dirtyBands;
+		
+		// Double-buffer mode: bands handed to present() by commitFrame(), and
+		// whether the front buffer is still owned by the present task.
+		DirtyRowBands presentBands;
+		bool frontBusy;
+		
+		// Transfer the given dirty bands of src to the panel (see DISPLAY_PARTIAL_PRESENT).
+		void sendBands(const uint16_t* src, const DirtyRowBands& bands);
+		
+		// Bytes sent to the panel by the last present().
+		uint32_t lastPresentedBytes;
+		
+		// DISPLAY_ROW_HASH: hash of each portrait row as last sent (internal RAM,
+		// nullptr when disabled), and the last present()'s results.
+		uint32_t* rowHashes;
+		RowHashStats lastRowHash;
 		
 public:
 		Arduino_GFX_Driver();
@@ -68,6 +114,9 @@ public:
 		void setBacklightBrightness(uint8_t brightness) override;  // 0-100%
 		uint8_t getBacklightBrightness() override;
 		bool hasBacklightControl() override;
+		bool fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) override;
+		bool backlightFading() const override;
+		bool setPanelSleep(bool sleep) override;
 		void applyDisplayFixes() override;
 		
 		void startWrite() override;
@@ -75,9 +124,12 @@ public:
 		void setAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
 		void pushColors(uint16_t* data, uint32_t len, bool swap_bytes = true) override;
 		
-		// Buffered render mode — present() flushes the full framebuffer to the panel.
+		// Buffered render mode — present() flushes the dirty rows to the panel.
 		RenderMode renderMode() const override { return RenderMode::Buffered; }
 		void present() override;
+		bool commitFrame() override;
+		uint32_t lastPresentBytes() const override { return lastPresentedBytes; }
+		RowHashStats lastPresentRowHash() const override { return lastRowHash; }
 };
 
 #endif // ARDUINO_GFX_DRIVER_H
@@ -34,10 +34,12 @@ void Arduino_GFX_ST77916_Driver::init() {
 		#if HAS_BACKLIGHT
 		#if ESP_ARDUINO_VERSION_MAJOR >= 3
 		double actualFreq = ledcAttach(LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, 8);
+		backlightFader.begin(LCD_BL_PIN);
 		LOGI("GFX_ST77916", "PWM attached on GPIO%d, actual freq: %.1f Hz", LCD_BL_PIN, actualFreq);
 		#else
 		ledcSetup(TFT_BACKLIGHT_PWM_CHANNEL, TFT_BACKLIGHT_PWM_FREQ, 8);
 		ledcAttachPin(LCD_BL_PIN, TFT_BACKLIGHT_PWM_CHANNEL);
+		backlightFader.begin(TFT_BACKLIGHT_PWM_CHANNEL);
 		LOGI("GFX_ST77916", "PWM setup complete on GPIO%d (channel %d)", LCD_BL_PIN, TFT_BACKLIGHT_PWM_CHANNEL);
 		#endif
 		backlightPwmAttached = true;
@@ -131,6 +133,7 @@ void Arduino_GFX_ST77916_Driver::setBacklight(bool on) {
 }
 
 void Arduino_GFX_ST77916_Driver::setBacklightBrightness(uint8_t brightness) {
+		backlightFader.cancel();  // A direct write ends any running fade
 		#ifdef LCD_BL_PIN
 		if (brightness > 100) brightness = 100;
 		currentBrightness = brightness;
@@ -165,6 +168,7 @@ void Arduino_GFX_ST77916_Driver::setBacklightBrightness(uint8_t brightness) {
 }
 
 uint8_t Arduino_GFX_ST77916_Driver::getBacklightBrightness() {
+		if (backlightFader.active()) return backlightFader.brightness();
 		return currentBrightness;
 }
 
@@ -176,6 +180,32 @@ bool Arduino_GFX_ST77916_Driver::hasBacklightControl() {
 		#endif
 }
 
+bool Arduino_GFX_ST77916_Driver::fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) {
+		#if defined(LCD_BL_PIN) && HAS_BACKLIGHT && BACKLIGHT_FADE_ENGINE
+		if (to > 100) to = 100;
+		if (!backlightFader.start(from, to, duration_ms)) return false;
+		currentBrightness = to;
+		return true;
+		#else
+		return false;
+		#endif
+}
+
+bool Arduino_GFX_ST77916_Driver::backlightFading() const {
+		return backlightFader.active();
+}
+
+bool Arduino_GFX_ST77916_Driver::setPanelSleep(bool sleep) {
+		if (!gfx) return false;
+		Arduino_ST77916* panel = static_cast<Arduino_ST77916*>(gfx);
+		if (sleep) {
+				panel->displayOff();
+		} else {
+				panel->displayOn();
+		}
+		return true;
+}
+
 void Arduino_GFX_ST77916_Driver::applyDisplayFixes() {
 		// IPS=true in the constructor already handles color inversion.
 		// No additional fixes needed for ST77916.
@@ -15,6 +15,7 @@
 
 #include "../display_driver.h"
 #include "../board_config.h"
+#include "backlight_fader.h"
 #include <Arduino_GFX_Library.h>
 
 class Arduino_GFX_ST77916_Driver : public DisplayDriver {
@@ -22,6 +23,7 @@ private:
 		Arduino_DataBus* bus;
 		Arduino_GFX* gfx;
 		uint8_t currentBrightness;
+		BacklightFader backlightFader;  // BACKLIGHT_FADE_ENGINE ramps
 		bool backlightPwmAttached;
 
 		// Current drawing area (set by setAddrWindow, used by pushColors)
@@ -40,6 +42,9 @@ public:
 		void setBacklightBrightness(uint8_t brightness) override;
 		uint8_t getBacklightBrightness() override;
 		bool hasBacklightControl() override;
+		bool fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) override;
+		bool backlightFading() const override;
+		bool setPanelSleep(bool sleep) override;
 		void applyDisplayFixes() override;
 
 		void startWrite() override;
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h>
+#include <math.h>
+
+// Backlight brightness -> LEDC duty mapping and gamma-corrected fade ramps.
+// No Arduino / IDF dependencies, so ramps can be checked on the host.
+//
+// Brightness is fixed point in 1/256 % (BACKLIGHT_Q8_FULL = 100 %), so a ramp
+// can pass between whole percentages instead of stepping through them.
+
+#define BACKLIGHT_Q8_ONE 256u
+#define BACKLIGHT_Q8_FULL (100u * BACKLIGHT_Q8_ONE)
+
+// Ramp resolution: brightness is interpolated linearly between knots.
+#define BACKLIGHT_RAMP_KNOTS 17
+
+// 8-bit duty for brightness b_q8. Same mapping as the drivers' whole-percent
+// setBacklightBrightness(): 0 -> 0, 1..99 % -> duty_min..duty_max, 100 % -> 255
+// (constant DC). Below 1 % it rises linearly from 0 to duty_min; between 99 %
+// and 100 % it holds duty_max.
+static inline uint32_t backlight_duty_q8(uint32_t b_q8, uint32_t duty_min, uint32_t duty_max) {
+		if (b_q8 == 0) return 0;
+		if (b_q8 >= BACKLIGHT_Q8_FULL) return 255;
+		if (b_q8 < BACKLIGHT_Q8_ONE) return (duty_min * b_q8) / BACKLIGHT_Q8_ONE;
+		const uint32_t duty = duty_min + ((b_q8 - BACKLIGHT_Q8_ONE) * (duty_max - duty_min)) / (98u * BACKLIGHT_Q8_ONE);
+		return duty > duty_max ? duty_max : duty;
+}
+
+struct BacklightRamp {
+		uint16_t knot_q8[BACKLIGHT_RAMP_KNOTS];  // Brightness at t = k / (KNOTS - 1)
+		uint32_t duration_ms;
+};
+
+// Ramp from -> to (percent) over duration_ms. Perceived lightness
+// (brightness^(1/gamma)) moves linearly in time, so the fade looks even instead
+// of rushing through the bright end. Knots are monotonic and end exactly on
+// from / to; gamma <= 0 is treated as 1 (linear).
+static inline void backlight_ramp_build(BacklightRamp* r, uint8_t from, uint8_t to, uint32_t duration_ms, float gamma) {
+		if (from > 100) from = 100;
+		if (to > 100) to = 100;
+		if (!(gamma > 0.0f)) gamma = 1.0f;
+
+		const float l_from = powf(from / 100.0f, 1.0f / gamma);
+		const float l_to = powf(to / 100.0f, 1.0f / gamma);
+		for (int k = 0; k < BACKLIGHT_RAMP_KNOTS; k++) {
+				const float l = l_from + (l_to - l_from) * (float)k / (float)(BACKLIGHT_RAMP_KNOTS - 1);
+				float b = powf(l < 0.0f ? 0.0f : l, gamma) * (float)BACKLIGHT_Q8_FULL + 0.5f;
+				if (b > (float)BACKLIGHT_Q8_FULL) b = (float)BACKLIGHT_Q8_FULL;
+				r->knot_q8[k] = (uint16_t)b;
+		}
+		r->knot_q8[0] = (uint16_t)(from * BACKLIGHT_Q8_ONE);
+		r->knot_q8[BACKLIGHT_RAMP_KNOTS - 1] = (uint16_t)(to * BACKLIGHT_Q8_ONE);
+
+		// Float rounding must never step backwards against the ramp direction.
+		for (int k = 1; k < BACKLIGHT_RAMP_KNOTS; k++) {
+				if (to >= from ? r->knot_q8[k] < r->knot_q8[k - 1] : r->knot_q8[k] > r->knot_q8[k - 1]) {
+						r->knot_q8[k] = r->knot_q8[k - 1];
+				}
+		}
+		r->duration_ms = duration_ms;
+}
+
+// Brightness (1/256 %) at elapsed_ms; the end value once the ramp is over.
+static inline uint32_t backlight_ramp_at(const BacklightRamp* r, uint32_t elapsed_ms) {
+		if (elapsed_ms >= r->duration_ms) return r->knot_q8[BACKLIGHT_RAMP_KNOTS - 1];
+
+		const uint64_t pos = (uint64_t)elapsed_ms * (BACKLIGHT_RAMP_KNOTS - 1);
+		const uint32_t seg = (uint32_t)(pos / r->duration_ms);
+		const uint32_t frac = (uint32_t)(pos % r->duration_ms);
+		const int32_t a = r->knot_q8[seg];
+		const int32_t b = r->knot_q8[seg + 1];
+		return (uint32_t)(a + (int32_t)(((int64_t)(b - a) * frac) / r->duration_ms));
+}
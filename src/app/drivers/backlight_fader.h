@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../board_config.h"
+#include "backlight_curve.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Timer-driven backlight fade for LEDC PWM backlights (BACKLIGHT_FADE_ENGINE).
+//
+// start() builds a gamma-corrected BacklightRamp once and plays it from a
+// periodic esp_timer (BACKLIGHT_FADE_TICK_MS, esp_timer task), writing the
+// LEDC duty directly. The main loop only starts the fade and later sees
+// active() turn false.
+//
+// LEDC hardware fades are linear in duty and the Arduino core has no call to
+// stop one early, so the ramp is stepped in software at the timer rate; with
+// 8-bit duty that is below one duty step per tick on typical fades.
+//
+// Drivers call cancel() before any direct duty write (setBacklightBrightness)
+// so a running ramp can never overwrite it.
+class BacklightFader {
+public:
+		// ledcTarget: what the driver passes to ledcWrite() (pin on core 3.x, channel on 2.x).
+		void begin(uint8_t ledcTarget) {
+				target = ledcTarget;
+				attached = true;
+		}
+
+		bool start(uint8_t from, uint8_t to, uint16_t duration_ms) {
+				if (!attached || duration_ms == 0 || !ensureTimer()) return false;
+
+				xSemaphoreTake(mutex, portMAX_DELAY);
+				esp_timer_stop(timer);  // ESP_ERR_INVALID_STATE when idle: fine
+				backlight_ramp_build(&ramp, from, to, duration_ms, BACKLIGHT_FADE_GAMMA);
+				startUs = esp_timer_get_time();
+				writeDuty(ramp.knot_q8[0]);
+				const bool ok = esp_timer_start_periodic(timer, (uint64_t)BACKLIGHT_FADE_TICK_MS * 1000) == ESP_OK;
+				__atomic_store_n(&running, ok, __ATOMIC_RELEASE);
+				xSemaphoreGive(mutex);
+				return ok;
+		}
+
+		void cancel() {
+				if (!mutex) return;
+				xSemaphoreTake(mutex, portMAX_DELAY);
+				esp_timer_stop(timer);
+				__atomic_store_n(&running, false, __ATOMIC_RELEASE);
+				xSemaphoreGive(mutex);
+		}
+
+		bool active() const {
+				return __atomic_load_n(&running, __ATOMIC_ACQUIRE);
+		}
+
+		// Brightness (percent) last written by the ramp.
+		uint8_t brightness() const {
+				return (uint8_t)((__atomic_load_n(&liveQ8, __ATOMIC_RELAXED) + BACKLIGHT_Q8_ONE / 2) / BACKLIGHT_Q8_ONE);
+		}
+
+private:
+		bool ensureTimer() {
+				if (timer) return true;
+				if (!mutex) mutex = xSemaphoreCreateMutex();
+				if (!mutex) return false;
+
+				esp_timer_create_args_t args = {};
+				args.callback = &BacklightFader::onTick;
+				args.arg = this;
+				args.dispatch_method = ESP_TIMER_TASK;
+				args.name = "bl_fade";
+				return esp_timer_create(&args, &timer) == ESP_OK;
+		}
+
+		static void onTick(void* arg) {
+				BacklightFader* self = static_cast<BacklightFader*>(arg);
+				xSemaphoreTake(self->mutex, portMAX_DELAY);
+				if (self->running) {
+						const uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - self->startUs) / 1000);
+						self->writeDuty(backlight_ramp_at(&self->ramp, elapsed_ms));
+						if (elapsed_ms >= self->ramp.duration_ms) {
+								esp_timer_stop(self->timer);
+								__atomic_store_n(&self->running, false, __ATOMIC_RELEASE);
+						}
+				}
+				xSemaphoreGive(self->mutex);
+		}
+
+		void writeDuty(uint32_t b_q8) {
+				__atomic_store_n(&liveQ8, b_q8, __ATOMIC_RELAXED);
+				uint32_t duty = backlight_duty_q8(b_q8, TFT_BACKLIGHT_DUTY_MIN, TFT_BACKLIGHT_DUTY_MAX);
+				#ifdef TFT_BACKLIGHT_ON
+				if (!TFT_BACKLIGHT_ON) duty = 255 - duty;  // Invert for active-low
+				#endif
+				ledcWrite(target, duty);
+		}
+
+		esp_timer_handle_t timer = nullptr;
+		SemaphoreHandle_t mutex = nullptr;
+		BacklightRamp ramp = {};
+		int64_t startUs = 0;
+		uint32_t liveQ8 = 0;
+		bool running = false;
+		bool attached = false;
+		uint8_t target = 0;
+};
@@ -0,0 +1,96 @@
+/*
+ * Dirty Row Bands
+ *
+ * Small fixed-size set of merged [first, last] row ranges, used by the
+ * buffered drivers to remember which framebuffer rows pushColors()
+ * touched since the last present().
+ *
+ * - Overlapping or adjacent bands are merged on add().
+ * - When all slots are in use, the new band is merged into its nearest
+ *   neighbour (over-sending a few clean rows is cheaper than an extra
+ *   panel transaction).
+ * - Not thread-safe: callers guard add()/take with their own spinlock
+ *   (see the dirty mux in each driver).  Everything is O(DIRTY_BANDS_MAX).
+ */
+
+#ifndef DIRTY_BANDS_H
+#define DIRTY_BANDS_H
+
+#include <stdint.h>
+
+// Maximum number of separate row bands tracked per frame.
+#ifndef DIRTY_BANDS_MAX
+#define DIRTY_BANDS_MAX 4
+#endif
+
+struct DirtyRowBand {
+		uint16_t first;
+		uint16_t last;   // inclusive
+};
+
+struct DirtyRowBands {
+		DirtyRowBand bands[DIRTY_BANDS_MAX];
+		uint8_t count;
+
+		void clear() { count = 0; }
+		bool empty() const { return count == 0; }
+
+		uint16_t minRow() const {
+				uint16_t v = bands[0].first;
+				for (uint8_t i = 1; i < count; i++) if (bands[i].first < v) v = bands[i].first;
+				return v;
+		}
+
+		uint16_t maxRow() const {
+				uint16_t v = bands[0].last;
+				for (uint8_t i = 1; i < count; i++) if (bands[i].last > v) v = bands[i].last;
+				return v;
+		}
+
+		uint32_t rowCount() const {
+				uint32_t rows = 0;
+				for (uint8_t i = 0; i < count; i++) rows += (uint32_t)(bands[i].last - bands[i].first + 1);
+				return rows;
+		}
+
+		void add(uint16_t first, uint16_t last) {
+				if (last < first) { uint16_t t = first; first = last; last = t; }
+
+				// Absorb every band that overlaps or touches [first, last].
+				uint8_t i = 0;
+				while (i < count) {
+						const DirtyRowBand& b = bands[i];
+						if ((uint32_t)first <= (uint32_t)b.last + 1 && (uint32_t)last + 1 >= (uint32_t)b.first) {
+								if (b.first < first) first = b.first;
+								if (b.last > last) last = b.last;
+								bands[i] = bands[--count];
+						} else {
+								i++;
+						}
+				}
+
+				if (count == DIRTY_BANDS_MAX) {
+						// Out of slots: merge the new band into its nearest neighbour.
+						uint8_t best = 0;
+						uint32_t bestGap = UINT32_MAX;
+						for (uint8_t j = 0; j < count; j++) {
+								const uint32_t gap = (bands[j].first > last)
+										? (uint32_t)(bands[j].first - last)
+										: (uint32_t)(first - bands[j].last);
+								if (gap < bestGap) { bestGap = gap; best = j; }
+						}
+						if (bands[best].first < first) first = bands[best].first;
+						if (bands[best].last > last) last = bands[best].last;
+						bands[best] = bands[--count];
+						// The widened band may now touch another one.
+						add(first, last);
+						return;
+				}
+
+				bands[count].first = first;
+				bands[count].last = last;
+				count++;
+		}
+};
+
+#endif // DIRTY_BANDS_H
@@ -10,7 +10,7 @@
 GT911_TouchDriver::GT911_TouchDriver()
 		: addr(TOUCH_I2C_ADDR), rotation(0), calibrationEnabled(false),
 			calXMin(0), calXMax(0), calYMin(0), calYMax(0),
-			lastTouched(false), lastX(0), lastY(0) {}
+			lastTouched(false), lastCount(0), lastX{}, lastY{} {}
 
 void GT911_TouchDriver::init() {
 		LOGI("GT911", "Initializing touch on %s (SDA=%d, SCL=%d, ADDR=0x%02X)",
@@ -95,13 +95,16 @@ void GT911_TouchDriver::gt911Read() {
 		}
 
 		lastTouched = (touches > 0);
+		lastCount = touches < GT911_MAX_POINTS ? touches : GT911_MAX_POINTS;
 
 		if (lastTouched) {
-				// Read first touch point only (7 bytes: id, x_lo, x_hi, y_lo, y_hi, size_lo, size_hi)
-				uint8_t data[7];
-				readBlock(GT911_POINT_1, data, 7);
-				lastX = data[1] | (data[2] << 8);
-				lastY = data[3] | (data[4] << 8);
+				// 8 bytes per point: id, x_lo, x_hi, y_lo, y_hi, size_lo, size_hi, reserved
+				uint8_t data[8 * GT911_MAX_POINTS];
+				readBlock(GT911_POINT_1, data, (uint8_t)(8 * lastCount));
+				for (uint8_t i = 0; i < lastCount; i++) {
+						lastX[i] = data[8 * i + 1] | (data[8 * i + 2] << 8);
+						lastY[i] = data[8 * i + 3] | (data[8 * i + 4] << 8);
+				}
 		}
 
 		// Clear buffer status flag (must always be done after reading)
@@ -122,9 +125,32 @@ bool GT911_TouchDriver::getTouch(uint16_t* x, uint16_t* y, uint16_t* pressure) {
 		gt911Read();
 		if (!lastTouched) return false;
 
-		uint16_t tx = lastX;
-		uint16_t ty = lastY;
+		uint16_t tx = lastX[0];
+		uint16_t ty = lastY[0];
+		mapPoint(tx, ty);
+
+		*x = tx;
+		*y = ty;
+		return true;
+}
+
+uint8_t GT911_TouchDriver::getTouchPoints(TouchPoint* points, uint8_t max) {
+		if (!points) return 0;
+
+		gt911Read();
+		if (!lastTouched) return 0;
+
+		const uint8_t n = lastCount < max ? lastCount : max;
+		for (uint8_t i = 0; i < n; i++) {
+				points[i].x = lastX[i];
+				points[i].y = lastY[i];
+				mapPoint(points[i].x, points[i].y);
+		}
+		return n;
+}
 
+// Raw controller coordinates -> screen space (calibration, then rotation).
+void GT911_TouchDriver::mapPoint(uint16_t& tx, uint16_t& ty) const {
 		// Apply calibration if configured
 		if (calibrationEnabled && calXMax > calXMin && calYMax > calYMin) {
 				uint32_t cx = tx;
@@ -139,10 +165,6 @@ bool GT911_TouchDriver::getTouch(uint16_t* x, uint16_t* y, uint16_t* pressure) {
 		}
 
 		applyRotation(tx, ty);
-
-		*x = tx;
-		*y = ty;
-		return true;
 }
 
 void GT911_TouchDriver::setCalibration(uint16_t x_min, uint16_t x_max, uint16_t y_min, uint16_t y_max) {
@@ -30,6 +30,9 @@
 #define GT911_WIRE_NAME "Wire1"
 #endif
 
+// Contacts read per scan (the controller tracks up to 5; two cover pinch).
+#define GT911_MAX_POINTS 2
+
 class GT911_TouchDriver : public TouchDriver {
 public:
 		GT911_TouchDriver();
@@ -39,10 +42,15 @@ public:
 
 		bool isTouched() override;
 		bool getTouch(uint16_t* x, uint16_t* y, uint16_t* pressure = nullptr) override;
+		uint8_t getTouchPoints(TouchPoint* points, uint8_t max) override;
 
 		void setCalibration(uint16_t x_min, uint16_t x_max, uint16_t y_min, uint16_t y_max) override;
 		void setRotation(uint8_t rotation) override;
 
+		#if defined(TOUCH_INT)
+		int interruptPin() const override { return TOUCH_INT; }
+		#endif
+
 private:
 		uint8_t addr;
 		uint8_t rotation;
@@ -53,10 +61,11 @@ private:
 		uint16_t calYMin;
 		uint16_t calYMax;
 
-		// Cached state from last read()
+		// Cached state from last read() (raw controller coordinates)
 		bool lastTouched;
-		uint16_t lastX;
-		uint16_t lastY;
+		uint8_t lastCount;
+		uint16_t lastX[GT911_MAX_POINTS];
+		uint16_t lastY[GT911_MAX_POINTS];
 
 		// Low-level GT911 I2C operations (Wire1)
 		void gt911Read();
@@ -65,6 +74,7 @@ private:
 		void readBlock(uint16_t reg, uint8_t* buf, uint8_t len);
 
 		void applyRotation(uint16_t& x, uint16_t& y) const;
+		void mapPoint(uint16_t& x, uint16_t& y) const;
 };
 
 #endif // GT911_TOUCH_DRIVER_H
@@ -0,0 +1,168 @@
+/*
+ * Headless Display Driver Implementation
+ *
+ * In-memory RGB565 framebuffer, no panel I/O.  See header for details.
+ */
+
+#include "headless_driver.h"
+#include "../log_manager.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+// Spinlock protecting dirtyBands shared between
+// pushColors() (LVGL task) and present() (async present task).
+static portMUX_TYPE s_headless_dirty_mux = portMUX_INITIALIZER_UNLOCKED;
+
+Headless_Driver::Headless_Driver()
+		: displayWidth(DISPLAY_WIDTH), displayHeight(DISPLAY_HEIGHT), displayRotation(0),
+			currentBrightness(100),
+			currentX(0), currentY(0), currentW(0), currentH(0),
+			framebuffer(nullptr), dirtyBands{}, lastPresentedBytes(0),
+			rowHashes(nullptr), lastRowHash{},
+			presentCount(0), presentedPixels(0) {
+}
+
+Headless_Driver::~Headless_Driver() {
+		if (framebuffer) { heap_caps_free(framebuffer); framebuffer = nullptr; }
+		if (rowHashes) { heap_caps_free(rowHashes); rowHashes = nullptr; }
+}
+
+void Headless_Driver::init() {
+		LOGI("Headless", "Initializing headless display driver");
+
+		// Same pixel count for every rotation, so allocate once up front.
+		size_t fbBytes = (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * sizeof(uint16_t);
+		framebuffer = (uint16_t*)heap_caps_malloc(fbBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		if (!framebuffer) {
+				framebuffer = (uint16_t*)heap_caps_malloc(fbBytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		}
+		if (framebuffer) {
+				memset(framebuffer, 0, fbBytes);
+				LOGI("Headless", "Framebuffer allocated: %u bytes (%ux%u)", (unsigned)fbBytes, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+		} else {
+				LOGE("Headless", "Failed to allocate framebuffer! (%u bytes)", (unsigned)fbBytes);
+		}
+
+		#if DISPLAY_ROW_HASH
+		// Sized for the larger dimension so any rotation fits.
+		if (framebuffer) {
+				const uint16_t maxRows = DISPLAY_WIDTH > DISPLAY_HEIGHT ? DISPLAY_WIDTH : DISPLAY_HEIGHT;
+				rowHashes = (uint32_t*)heap_caps_malloc((size_t)maxRows * sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+				if (rowHashes) {
+						row_hash_reset(rowHashes, maxRows);
+				} else {
+						LOGW("Headless", "Row hashing disabled: alloc failed");
+				}
+		}
+		#endif
+}
+
+void Headless_Driver::setRotation(uint8_t rotation) {
+		// No physical panel: the framebuffer simply adopts the logical orientation.
+		displayRotation = rotation;
+		if (rotation == 1 || rotation == 3) {
+				displayWidth = DISPLAY_HEIGHT;
+				displayHeight = DISPLAY_WIDTH;
+		} else {
+				displayWidth = DISPLAY_WIDTH;
+				displayHeight = DISPLAY_HEIGHT;
+		}
+		// Row layout changed: stored hashes no longer describe these rows.
+		if (rowHashes) row_hash_reset(rowHashes, displayHeight);
+		LOGI("Headless", "Rotation %d (logical %ux%u)", rotation, displayWidth, displayHeight);
+}
+
+int Headless_Driver::width() {
+		return (int)displayWidth;
+}
+
+int Headless_Driver::height() {
+		return (int)displayHeight;
+}
+
+void Headless_Driver::setBacklight(bool on) {
+		currentBrightness = on ? 100 : 0;
+}
+
+void Headless_Driver::setBacklightBrightness(uint8_t brightness) {
+		if (brightness > 100) brightness = 100;
+		currentBrightness = brightness;
+}
+
+uint8_t Headless_Driver::getBacklightBrightness() {
+		return currentBrightness;
+}
+
+bool Headless_Driver::hasBacklightControl() {
+		return false;
+}
+
+void Headless_Driver::applyDisplayFixes() {
+		// Nothing to configure without a panel.
+}
+
+void Headless_Driver::startWrite() {
+		// No bus transaction.
+}
+
+void Headless_Driver::endWrite() {
+		// No bus transaction.
+}
+
+void Headless_Driver::setAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+		currentX = x;
+		currentY = y;
+		currentW = w;
+		currentH = h;
+}
+
+void Headless_Driver::pushColors(uint16_t* data, uint32_t len, bool swap_bytes) {
+		(void)len;
+		if (!framebuffer || !data || currentW == 0 || currentH == 0) return;
+		if (currentX < 0 || currentY < 0) return;
+		if (currentX + currentW > displayWidth || currentY + currentH > displayHeight) return;
+
+		const uint16_t w = currentW;
+		const uint16_t h = currentH;
+
+		// Honour LVGL's padded row stride (bytes) when set by the flush callback.
+		const uint32_t srcStridePx = flushSrcStride ? (flushSrcStride / sizeof(uint16_t)) : w;
+
+		rgb565_copy_rect(&framebuffer[(size_t)currentY * displayWidth + currentX], displayWidth,
+				data, srcStridePx, w, h, swap_bytes);
+
+		portENTER_CRITICAL(&s_headless_dirty_mux);
+		dirtyBands.add((uint16_t)currentY, (uint16_t)(currentY + h - 1));
+		portEXIT_CRITICAL(&s_headless_dirty_mux);
+}
+
+void Headless_Driver::present() {
+		if (!framebuffer) return;
+
+		portENTER_CRITICAL(&s_headless_dirty_mux);
+		if (dirtyBands.empty()) {
+				portEXIT_CRITICAL(&s_headless_dirty_mux);
+				lastPresentedBytes = 0;
+				lastRowHash = RowHashStats{0, 0, 0};
+				return;
+		}
+		DirtyRowBands bands = dirtyBands;
+		dirtyBands.clear();
+		portEXIT_CRITICAL(&s_headless_dirty_mux);
+
+		lastRowHash = RowHashStats{0, 0, 0};
+		if (rowHashes) {
+				const int64_t hashStart = esp_timer_get_time();
+				DirtyRowBands changed;
+				lastRowHash.rows_skipped = row_hash_filter(rowHashes, framebuffer, displayWidth, displayHeight,
+						bands, &changed, &lastRowHash.rows_hashed);
+				lastRowHash.hash_us = (uint32_t)(esp_timer_get_time() - hashStart);
+				bands = changed;
+		}
+		const uint32_t rows = bands.rowCount();
+
+		// No panel transfer — account for what a panel would have received.
+		presentCount++;
+		presentedPixels += (uint64_t)rows * displayWidth;
+		lastPresentedBytes = rows * displayWidth * sizeof(uint16_t);
+}
@@ -0,0 +1,91 @@
+/*
+ * Headless Display Driver
+ *
+ * Panel-less DisplayDriver that renders into an in-memory RGB565
+ * framebuffer.  Used to run the full DisplayManager render loop
+ * (lv_timer_handler → flushCallback → present) with no panel
+ * attached, so rendering cost can be measured without real panels:
+ * on Linux by the host frame benchmark (tests/frame_bench.cpp, heap
+ * framebuffer via the heap_caps stub), and on a bare ESP32-S3 dev
+ * board with PSRAM (the esp32s3-headless target).
+ *
+ * Behaviour:
+ *   - Buffered render mode, so the async present task and present()
+ *     timing are exercised exactly like the QSPI buffered drivers.
+ *   - The framebuffer is kept in LOGICAL orientation (post-rotation);
+ *     there is no physical panel to transpose for.
+ *   - pushColors() honours flushSrcStride and swap_bytes so the copy
+ *     cost matches a real Direct/Buffered driver.
+ *   - present() consumes the merged dirty bands and counts the rows and
+ *     bytes that a panel honouring address windows would have received
+ *     (after dropping unchanged rows when DISPLAY_ROW_HASH is set).
+ *   - Backlight calls are accepted and tracked (no GPIO).
+ */
+
+#ifndef HEADLESS_DRIVER_H
+#define HEADLESS_DRIVER_H
+
+#include "../display_driver.h"
+#include "../board_config.h"
+#include "dirty_bands.h"
+#include "rgb565_copy.h"
+#include "row_hash.h"
+
+class Headless_Driver : public DisplayDriver {
+private:
+		uint16_t displayWidth;      // Logical width (post-rotation)
+		uint16_t displayHeight;     // Logical height (post-rotation)
+		uint8_t displayRotation;
+		uint8_t currentBrightness;
+
+		// Current drawing area (set by setAddrWindow, used by pushColors)
+		int16_t currentX, currentY;
+		uint16_t currentW, currentH;
+
+		// In-memory framebuffer (PSRAM preferred, internal RAM fallback).
+		uint16_t* framebuffer;
+
+		// Rows touched since the last present() (merged bands).
+		DirtyRowBands dirtyBands;
+		uint32_t lastPresentedBytes;
+
+		// DISPLAY_ROW_HASH: per-row hashes as last "sent" (nullptr when disabled).
+		uint32_t* rowHashes;
+		RowHashStats lastRowHash;
+
+		// Totals since init (read by benchmarks / diagnostics).
+		uint32_t presentCount;
+		uint64_t presentedPixels;
+
+public:
+		Headless_Driver();
+		~Headless_Driver() override;
+
+		void init() override;
+		void setRotation(uint8_t rotation) override;
+		int width() override;
+		int height() override;
+		void setBacklight(bool on) override;
+		void setBacklightBrightness(uint8_t brightness) override;  // 0-100%
+		uint8_t getBacklightBrightness() override;
+		bool hasBacklightControl() override;
+		void applyDisplayFixes() override;
+
+		void startWrite() override;
+		void endWrite() override;
+		void setAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
+		void pushColors(uint16_t* data, uint32_t len, bool swap_bytes = true) override;
+
+		// Buffered render mode — present() "transfers" the dirty rows.
+		RenderMode renderMode() const override { return RenderMode::Buffered; }
+		void present() override;
+		uint32_t lastPresentBytes() const override { return lastPresentedBytes; }
+		RowHashStats lastPresentRowHash() const override { return lastRowHash; }
+
+		// Read-only access to the rendered frame (e.g. for golden-image checks).
+		const uint16_t* getFramebuffer() const { return framebuffer; }
+		uint32_t getPresentCount() const { return presentCount; }
+		uint64_t getPresentedPixels() const { return presentedPixels; }
+};
+
+#endif // HEADLESS_DRIVER_H
@@ -52,12 +52,14 @@ void MipiDsiDriver::init() {
     #if HAS_BACKLIGHT
     #if ESP_ARDUINO_VERSION_MAJOR >= 3
     ledcAttachChannel(LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, 8, TFT_BACKLIGHT_PWM_CHANNEL);
+    backlightFader.begin(LCD_BL_PIN);
     ledcWrite(LCD_BL_PIN, 0);
     LOGI(tag, "Backlight PWM: GPIO%d, %dHz, 8-bit, ch%d (OFF)",
          LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, TFT_BACKLIGHT_PWM_CHANNEL);
     #else
     ledcSetup(TFT_BACKLIGHT_PWM_CHANNEL, TFT_BACKLIGHT_PWM_FREQ, 8);
     ledcAttachPin(LCD_BL_PIN, TFT_BACKLIGHT_PWM_CHANNEL);
+    backlightFader.begin(TFT_BACKLIGHT_PWM_CHANNEL);
     ledcWrite(TFT_BACKLIGHT_PWM_CHANNEL, 0);
     LOGI(tag, "Backlight PWM: GPIO%d, %dHz, 8-bit, ch%d (OFF)",
          LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, TFT_BACKLIGHT_PWM_CHANNEL);
@@ -205,6 +207,7 @@ void MipiDsiDriver::setBacklight(bool on) {
 }
 
 void MipiDsiDriver::setBacklightBrightness(uint8_t brightness) {
+    backlightFader.cancel();  // A direct write ends any running fade
     if (brightness > 100) brightness = 100;
     currentBrightness = brightness;
     backlightOn = (brightness > 0);
@@ -236,6 +239,7 @@ void MipiDsiDriver::setBacklightBrightness(uint8_t brightness) {
 }
 
 uint8_t MipiDsiDriver::getBacklightBrightness() {
+    if (backlightFader.active()) return backlightFader.brightness();
     return currentBrightness;
 }
 
@@ -247,6 +251,22 @@ bool MipiDsiDriver::hasBacklightControl() {
     #endif
 }
 
+bool MipiDsiDriver::fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) {
+    #if defined(LCD_BL_PIN) && HAS_BACKLIGHT && BACKLIGHT_FADE_ENGINE
+    if (to > 100) to = 100;
+    if (!backlightFader.start(from, to, duration_ms)) return false;
+    currentBrightness = to;
+    backlightOn = (to > 0);
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+bool MipiDsiDriver::backlightFading() const {
+    return backlightFader.active();
+}
+
 void MipiDsiDriver::applyDisplayFixes() {
     // No specific fixes needed for MIPI-DSI panels
 }
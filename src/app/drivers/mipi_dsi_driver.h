@@ -40,6 +40,7 @@
 
 #include "../display_driver.h"
 #include "../board_config.h"
+#include "backlight_fader.h"
 
 // ESP-IDF MIPI-DSI and LCD panel APIs (ESP32-P4 only)
 #include <esp_lcd_panel_ops.h>
@@ -77,6 +78,7 @@ protected:
     uint16_t* framebuffer;                   // DPI panel PSRAM framebuffer (from ESP-IDF)
     esp_lcd_panel_handle_t panel_handle;      // DPI panel handle
     uint8_t currentBrightness;               // Current brightness level (0-100%)
+    BacklightFader backlightFader;           // BACKLIGHT_FADE_ENGINE ramps
     uint16_t displayWidth;
     uint16_t displayHeight;
     uint8_t displayRotation;
@@ -103,6 +105,8 @@ public:
     void setBacklightBrightness(uint8_t brightness) override;
     uint8_t getBacklightBrightness() override;
     bool hasBacklightControl() override;
+    bool fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) override;
+    bool backlightFading() const override;
     void applyDisplayFixes() override;
 
     void startWrite() override;
@@ -0,0 +1,131 @@
+/*
+ * RGB565 Copy / Byte-Swap Kernels
+ *
+ * Row copies between RGB565 buffers with independent source and
+ * destination strides, optionally byte-swapping each pixel (LVGL renders
+ * little-endian RGB565, SPI/QSPI panels expect big-endian).
+ * rgb565_copy_rect() is used by the headless driver, rotation 0 of
+ * rgb565_rotate_blit() and DisplayManager's flush coalescing;
+ * rgb565_swap_copy() swaps the strip in place on TFT_eSPI's DMA flush path.
+ *
+ * Why word-at-a-time:
+ *   The per-pixel swap is one 16-bit load + shifts + one 16-bit store per
+ *   pixel.  Swapping two pixels in one 32-bit register
+ *       ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF)
+ *   halves the loads/stores and the loop overhead, which dominates when
+ *   the destination is PSRAM.
+ *
+ * Alignment:
+ *   Xtensa faults on unaligned 32-bit accesses, so the destination is
+ *   aligned with one scalar pixel first.  If the source then has the same
+ *   4-byte phase, both sides use word accesses; otherwise two 16-bit
+ *   loads are packed into one 32-bit store.  Odd tails are scalar.
+ *
+ * No ESP32-S3 PIE (EE.*) path: those instructions need 16-byte aligned
+ * operands on both sides, which LVGL strips at arbitrary x offsets and
+ * odd widths rarely provide, and the copies here are bound by PSRAM
+ * bandwidth rather than ALU throughput.
+ *
+ * rgb565_swap_copy_scalar() is the per-pixel reference.  The host test
+ * (tests/rgb565_copy_test.cpp) checks both kernels against it for every
+ * width up to 67 pixels and both 4-byte phases, and tests/rgb565_copy_bench
+ * and the on-device benchmark (display_benchmark) compare their MB/s.
+ *
+ * Header-only for the same reason as rgb565_rotate.h: driver .cpp files
+ * are compiled through display_drivers.cpp.
+ */
+
+#ifndef RGB565_COPY_H
+#define RGB565_COPY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// 32-bit view of two adjacent RGB565 pixels (may alias uint16_t storage).
+typedef uint32_t __attribute__((may_alias)) rgb565_word_t;
+
+static inline uint16_t rgb565_swap16(uint16_t p) {
+		return (uint16_t)((p >> 8) | (p << 8));
+}
+
+static inline uint32_t rgb565_swap32(uint32_t v) {
+		return ((v & 0x00FF00FFu) << 8) | ((v >> 8) & 0x00FF00FFu);
+}
+
+// Byte-swap n pixels from src into dst.  dst == src (in place) is allowed;
+// other overlap is not.
+static inline void rgb565_swap_copy(uint16_t* dst, const uint16_t* src, uint32_t n) {
+		if (n == 0) return;
+
+		if (((uintptr_t)dst) & 3) {
+				*dst++ = rgb565_swap16(*src++);
+				n--;
+		}
+
+		uint32_t pairs = n >> 1;
+		rgb565_word_t* d = (rgb565_word_t*)dst;
+
+		if ((((uintptr_t)src) & 3) == 0) {
+				const rgb565_word_t* s = (const rgb565_word_t*)src;
+				while (pairs >= 4) {
+						const uint32_t a = s[0], b = s[1], c = s[2], e = s[3];
+						d[0] = rgb565_swap32(a);
+						d[1] = rgb565_swap32(b);
+						d[2] = rgb565_swap32(c);
+						d[3] = rgb565_swap32(e);
+						s += 4;
+						d += 4;
+						pairs -= 4;
+				}
+				while (pairs--) {
+						*d++ = rgb565_swap32(*s++);
+				}
+				src = (const uint16_t*)s;
+		} else {
+				// Source is 2 bytes out of phase: pack two loads into one store.
+				while (pairs--) {
+						const uint32_t lo = rgb565_swap16(src[0]);
+						const uint32_t hi = rgb565_swap16(src[1]);
+						*d++ = lo | (hi << 16);
+						src += 2;
+				}
+		}
+
+		if (n & 1) {
+				*(uint16_t*)d = rgb565_swap16(*src);
+		}
+}
+
+// Copy a w×h block between buffers with pixel strides (>= w), optionally
+// byte-swapping.  Contiguous blocks (both strides == w) are one call.
+static inline void rgb565_copy_rect(
+		uint16_t* dst, uint32_t dstStridePx,
+		const uint16_t* src, uint32_t srcStridePx,
+		uint32_t w, uint32_t h, bool swap) {
+		if (w == 0 || h == 0) return;
+
+		if (dstStridePx == w && srcStridePx == w) {
+				w *= h;
+				h = 1;
+		}
+
+		for (uint32_t r = 0; r < h; r++) {
+				if (swap) {
+						rgb565_swap_copy(dst, src, w);
+				} else {
+						memcpy(dst, src, (size_t)w * sizeof(uint16_t));
+				}
+				dst += dstStridePx;
+				src += srcStridePx;
+		}
+}
+
+// Reference per-pixel swap (pre-kernel).  Same contract as rgb565_swap_copy().
+static inline void rgb565_swap_copy_scalar(uint16_t* dst, const uint16_t* src, uint32_t n) {
+		for (uint32_t i = 0; i < n; i++) {
+				dst[i] = rgb565_swap16(src[i]);
+		}
+}
+
+#endif // RGB565_COPY_H
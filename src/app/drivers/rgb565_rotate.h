@@ -0,0 +1,159 @@
+/*
+ * RGB565 Rotation Kernel
+ *
+ * Copies an LVGL flush strip (logical coordinates) into a framebuffer
+ * kept in the panel's physical (portrait) orientation.  Shared by the
+ * buffered drivers that do driver-level rotation.
+ *
+ * Why tiled:
+ *   For landscape rotations (1, 3) the source is read row-by-row but
+ *   each source row lands in a framebuffer COLUMN.  The naive loop
+ *   writes one pixel per displayWidth stride, so every store touches
+ *   a different PSRAM cache line and the cache thrashes on every strip.
+ *   Walking the strip in RGB565_ROTATE_TILE² blocks keeps the working
+ *   set (TILE source rows + TILE destination rows) resident, and two
+ *   vertically adjacent source pixels are combined into one 32-bit
+ *   store to halve the number of PSRAM writes.
+ *
+ * Rotations 0 and 2 are already sequential in both buffers and use
+ * row copies (rgb565_copy_rect / reversed row copy).
+ *
+ * rgb565_rotate_blit_scalar() is the former per-pixel implementation,
+ * kept as the reference: tests/rgb565_rotate_test.cpp compares the tiled
+ * kernel against it, and tests/rgb565_rotate_bench and the on-device
+ * benchmark (display_benchmark) compare their MB/s.
+ *
+ * Header-only: driver .cpp files are compiled through display_drivers.cpp,
+ * so static inline keeps this usable from any of them without a new unit.
+ */
+
+#ifndef RGB565_ROTATE_H
+#define RGB565_ROTATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "rgb565_copy.h"
+
+// Tile edge in pixels (16 px = 32 bytes per tile row, one PSRAM cache line).
+#ifndef RGB565_ROTATE_TILE
+#define RGB565_ROTATE_TILE 16
+#endif
+
+// 32-bit view of two adjacent RGB565 pixels (may alias uint16_t storage).
+typedef uint32_t __attribute__((may_alias)) rgb565_pair_t;
+
+// Copy a w×h strip at logical (x, y) into the physical fb (fbW × fbH, portrait).
+// srcStridePx is the source row pitch in pixels (>= w).
+//
+// Mapping (matches Arduino_GFX_Driver):
+//   0: (lx, ly) → (lx, ly)
+//   1: (lx, ly) → (ly, fbH-1-lx)          90° CW
+//   2: (lx, ly) → (fbW-1-lx, fbH-1-ly)    180°
+//   3: (lx, ly) → (fbW-1-ly, lx)          270° CW
+static inline void rgb565_rotate_blit(
+		uint16_t* fb, uint16_t fbW, uint16_t fbH,
+		const uint16_t* src, uint32_t srcStridePx,
+		int16_t x, int16_t y, uint16_t w, uint16_t h,
+		uint8_t rotation) {
+		const uint16_t T = RGB565_ROTATE_TILE;
+
+		switch (rotation) {
+				case 0: {
+						rgb565_copy_rect(&fb[(size_t)y * fbW + x], fbW, src, srcStridePx, w, h, false);
+						break;
+				}
+				case 1: {
+						// Source row r → framebuffer column (y + r); source column c → row fbH-1-(x+c).
+						// Within a column, consecutive r are consecutive framebuffer pixels.
+						for (uint16_t r0 = 0; r0 < h; r0 += T) {
+								const uint16_t r1 = (uint16_t)((h - r0) < T ? h : r0 + T);
+								for (uint16_t c0 = 0; c0 < w; c0 += T) {
+										const uint16_t c1 = (uint16_t)((w - c0) < T ? w : c0 + T);
+										for (uint16_t c = c0; c < c1; c++) {
+												uint16_t* d = &fb[(size_t)(fbH - 1 - (x + c)) * fbW + y];
+												const uint16_t* s = &src[c];
+												uint16_t r = r0;
+												if ((((uintptr_t)(d + r)) & 3) && r < r1) {
+														d[r] = s[(size_t)r * srcStridePx];
+														r++;
+												}
+												for (; r + 1 < r1; r += 2) {
+														const uint32_t lo = s[(size_t)r * srcStridePx];
+														const uint32_t hi = s[(size_t)(r + 1) * srcStridePx];
+														*(rgb565_pair_t*)(d + r) = lo | (hi << 16);
+												}
+												if (r < r1) {
+														d[r] = s[(size_t)r * srcStridePx];
+												}
+										}
+								}
+						}
+						break;
+				}
+				case 2: {
+						for (uint16_t r = 0; r < h; r++) {
+								const uint16_t* s = &src[(size_t)r * srcStridePx];
+								uint16_t* d = &fb[(size_t)(fbH - 1 - (y + r)) * fbW + (fbW - 1 - x)];
+								for (uint16_t c = 0; c < w; c++) {
+										d[-(int32_t)c] = s[c];
+								}
+						}
+						break;
+				}
+				case 3: {
+						// Source row r → framebuffer column fbW-1-(y+r); source column c → row (x + c).
+						// Within a column, consecutive r walk the framebuffer row backwards.
+						for (uint16_t r0 = 0; r0 < h; r0 += T) {
+								const uint16_t r1 = (uint16_t)((h - r0) < T ? h : r0 + T);
+								for (uint16_t c0 = 0; c0 < w; c0 += T) {
+										const uint16_t c1 = (uint16_t)((w - c0) < T ? w : c0 + T);
+										for (uint16_t c = c0; c < c1; c++) {
+												uint16_t* d = &fb[(size_t)(x + c) * fbW + (fbW - 1 - y)];
+												const uint16_t* s = &src[c];
+												uint16_t r = r0;
+												// Pair (r, r+1) lands at d-r-1 (low half = r+1, high half = r).
+												if ((((uintptr_t)(d - r - 1)) & 3) && r < r1) {
+														*(d - r) = s[(size_t)r * srcStridePx];
+														r++;
+												}
+												for (; r + 1 < r1; r += 2) {
+														const uint32_t hi = s[(size_t)r * srcStridePx];
+														const uint32_t lo = s[(size_t)(r + 1) * srcStridePx];
+														*(rgb565_pair_t*)(d - r - 1) = lo | (hi << 16);
+												}
+												if (r < r1) {
+														*(d - r) = s[(size_t)r * srcStridePx];
+												}
+										}
+								}
+						}
+						break;
+				}
+		}
+}
+
+// Reference per-pixel implementation (pre-tiling).  Same mapping as above.
+static inline void rgb565_rotate_blit_scalar(
+		uint16_t* fb, uint16_t fbW, uint16_t fbH,
+		const uint16_t* src, uint32_t srcStridePx,
+		int16_t x, int16_t y, uint16_t w, uint16_t h,
+		uint8_t rotation) {
+		for (uint16_t r = 0; r < h; r++) {
+				for (uint16_t c = 0; c < w; c++) {
+						const int32_t lx = x + c;
+						const int32_t ly = y + r;
+						int32_t px, py;
+						switch (rotation) {
+								case 1:  px = ly;           py = fbH - 1 - lx; break;
+								case 2:  px = fbW - 1 - lx; py = fbH - 1 - ly; break;
+								case 3:  px = fbW - 1 - ly; py = lx;           break;
+								default: px = lx;           py = ly;           break;
+						}
+						fb[(size_t)py * fbW + px] = src[(size_t)r * srcStridePx + c];
+				}
+		}
+}
+
+#endif // RGB565_ROTATE_H
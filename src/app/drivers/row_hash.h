@@ -0,0 +1,98 @@
+/*
+ * Framebuffer Row Hashing
+ *
+ * Per-row content hashes for the buffered drivers (DISPLAY_ROW_HASH).
+ * LVGL regularly re-renders areas whose pixels come out identical (a
+ * label set to the same text, a redraw triggered by a style refresh).
+ * present() hashes each dirty row and drops rows whose hash matches the
+ * one recorded when that row was last sent, so the panel transfer only
+ * covers rows that actually changed.
+ *
+ * - Hash: FNV-1a over 32-bit words (one multiply per two pixels).  The
+ *   cost is a PSRAM read of every dirty row, paid in the present task.
+ * - A stored hash of 0 means "unknown" (never sent); computed hashes
+ *   always have bit 0 set, so unknown rows are always sent.
+ * - Invariant: hashes[r] describes what the panel shows in row r.  Rows
+ *   that are sent get their new hash; skipped rows keep theirs.  Rows
+ *   pulled in only by band merging were not dirty, so they already match.
+ * - Single-buffer caveat: a row rewritten while present() is sending it
+ *   and then reverted to the hashed content can stay stale until it next
+ *   changes.  DISPLAY_DOUBLE_BUFFER avoids that overlap entirely.
+ *
+ * Not thread-safe: only present() (one task) touches the hash table.
+ */
+
+#ifndef ROW_HASH_H
+#define ROW_HASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "dirty_bands.h"
+#include "rgb565_copy.h"
+
+static inline uint32_t row_hash_rgb565(const uint16_t* row, uint16_t w) {
+		uint32_t h = 2166136261u;
+		uint16_t c = 0;
+		if ((((uintptr_t)row) & 3) == 0) {
+				const rgb565_word_t* words = (const rgb565_word_t*)row;
+				for (; c + 1 < w; c += 2) {
+						h = (h ^ words[c >> 1]) * 16777619u;
+				}
+		} else {
+				for (; c + 1 < w; c += 2) {
+						h = (h ^ ((uint32_t)row[c] | ((uint32_t)row[c + 1] << 16))) * 16777619u;
+				}
+		}
+		if (c < w) {
+				h = (h ^ row[c]) * 16777619u;
+		}
+		return h | 1u;
+}
+
+// Forget all row hashes (every row is sent on its next present()).
+static inline void row_hash_reset(uint32_t* hashes, uint16_t rows) {
+		memset(hashes, 0, (size_t)rows * sizeof(uint32_t));
+}
+
+// Hash every row of `in` and write the rows that changed to `out` (merged
+// bands).  Returns the number of unchanged (skipped) rows; *rowsHashed is
+// set to the number of rows hashed.
+static inline uint32_t row_hash_filter(
+		uint32_t* hashes, const uint16_t* fb, uint16_t fbW, uint16_t fbH,
+		const DirtyRowBands& in, DirtyRowBands* out, uint32_t* rowsHashed) {
+		uint32_t hashed = 0;
+		uint32_t skipped = 0;
+		out->clear();
+
+		for (uint8_t i = 0; i < in.count; i++) {
+				const uint16_t first = in.bands[i].first;
+				uint16_t last = in.bands[i].last;
+				if (first >= fbH) continue;
+				if (last >= fbH) last = fbH - 1;
+
+				int32_t runStart = -1;
+				for (uint16_t r = first; r <= last; r++) {
+						const uint32_t h = row_hash_rgb565(&fb[(size_t)r * fbW], fbW);
+						hashed++;
+						if (h == hashes[r]) {
+								skipped++;
+								if (runStart >= 0) {
+										out->add((uint16_t)runStart, (uint16_t)(r - 1));
+										runStart = -1;
+								}
+								continue;
+						}
+						hashes[r] = h;
+						if (runStart < 0) runStart = r;
+				}
+				if (runStart >= 0) {
+						out->add((uint16_t)runStart, last);
+				}
+		}
+
+		if (rowsHashed) *rowsHashed = hashed;
+		return skipped;
+}
+
+#endif // ROW_HASH_H
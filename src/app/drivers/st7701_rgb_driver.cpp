@@ -215,12 +215,14 @@ void ST7701_RGB_Driver::init() {
 	// PWM brightness control
 	#if ESP_ARDUINO_VERSION_MAJOR >= 3
 	ledcAttachChannel(LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, 8, TFT_BACKLIGHT_PWM_CHANNEL);
+	backlightFader.begin(LCD_BL_PIN);
 	ledcWrite(LCD_BL_PIN, 0);  // Start OFF
 	LOGI("ST7701", "Backlight PWM: GPIO%d, %dHz, 8-bit, ch%d (OFF)",
 			LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, TFT_BACKLIGHT_PWM_CHANNEL);
 	#else
 	ledcSetup(TFT_BACKLIGHT_PWM_CHANNEL, TFT_BACKLIGHT_PWM_FREQ, 8);
 	ledcAttachPin(LCD_BL_PIN, TFT_BACKLIGHT_PWM_CHANNEL);
+	backlightFader.begin(TFT_BACKLIGHT_PWM_CHANNEL);
 	ledcWrite(TFT_BACKLIGHT_PWM_CHANNEL, 0);  // Start OFF
 	LOGI("ST7701", "Backlight PWM: GPIO%d, %dHz, 8-bit, ch%d (OFF)",
 			LCD_BL_PIN, TFT_BACKLIGHT_PWM_FREQ, TFT_BACKLIGHT_PWM_CHANNEL);
@@ -333,6 +335,7 @@ void ST7701_RGB_Driver::setBacklight(bool on) {
 }
 
 void ST7701_RGB_Driver::setBacklightBrightness(uint8_t brightness) {
+		backlightFader.cancel();  // A direct write ends any running fade
 		if (brightness > 100) brightness = 100;
 		currentBrightness = brightness;
 		backlightOn = (brightness > 0);
@@ -370,6 +373,7 @@ void ST7701_RGB_Driver::setBacklightBrightness(uint8_t brightness) {
 }
 
 uint8_t ST7701_RGB_Driver::getBacklightBrightness() {
+		if (backlightFader.active()) return backlightFader.brightness();
 		return currentBrightness;
 }
 
@@ -381,6 +385,22 @@ bool ST7701_RGB_Driver::hasBacklightControl() {
 		#endif
 }
 
+bool ST7701_RGB_Driver::fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) {
+		#if defined(LCD_BL_PIN) && HAS_BACKLIGHT && BACKLIGHT_FADE_ENGINE
+		if (to > 100) to = 100;
+		if (!backlightFader.start(from, to, duration_ms)) return false;
+		currentBrightness = to;
+		backlightOn = (to > 0);
+		return true;
+		#else
+		return false;
+		#endif
+}
+
+bool ST7701_RGB_Driver::backlightFading() const {
+		return backlightFader.active();
+}
+
 void ST7701_RGB_Driver::applyDisplayFixes() {
 		// No specific fixes needed for ST7701 RGB
 }
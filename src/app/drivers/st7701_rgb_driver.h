@@ -25,6 +25,7 @@
 
 #include "../display_driver.h"
 #include "../board_config.h"
+#include "backlight_fader.h"
 #include <Arduino_GFX_Library.h>
 
 // Forward declarations (Arduino_GFX classes)
@@ -37,6 +38,7 @@ private:
 		Arduino_ESP32RGBPanel* rgbpanel;         // RGB panel bus (ESP-IDF panel wrapper)
 		Arduino_RGB_Display* gfx;               // Display draw API (framebuffer + cache mgmt)
 		uint8_t currentBrightness;              // Current brightness level (0-100%)
+		BacklightFader backlightFader;          // BACKLIGHT_FADE_ENGINE ramps
 		uint16_t displayWidth;
 		uint16_t displayHeight;
 		uint8_t displayRotation;
@@ -60,6 +62,8 @@ public:
 		void setBacklightBrightness(uint8_t brightness) override;  // 0-100%
 		uint8_t getBacklightBrightness() override;
 		bool hasBacklightControl() override;
+		bool fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) override;
+		bool backlightFading() const override;
 		void applyDisplayFixes() override;
 		
 		void startWrite() override;
@@ -1,7 +1,19 @@
 #include "tft_espi_driver.h"
+#include "rgb565_copy.h"
 #include "../log_manager.h"
 
-TFT_eSPI_Driver::TFT_eSPI_Driver() : currentBrightness(100) {
+#include <esp_arduino_version.h>
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+#include <esp_memory_utils.h>
+#else
+#include <soc/soc_memory_layout.h>  // esp_ptr_dma_capable() on IDF 4.x
+#endif
+#include <esp_timer.h>
+
+TFT_eSPI_Driver::TFT_eSPI_Driver()
+		: currentBrightness(100), dmaEnabled(false), busHeld(false),
+		  winX(0), winY(0), winW(0), winH(0), dmaQueuedUs(0), dmaWireEstUs(0),
+		  dmaStats{0, 0, 0, 0}, dmaStatsMux(portMUX_INITIALIZER_UNLOCKED) {
 		// TFT_eSPI constructor already called
 		// Initialize brightness to 100% (full brightness)
 }
@@ -9,6 +21,16 @@ TFT_eSPI_Driver::TFT_eSPI_Driver() : currentBrightness(100) {
 void TFT_eSPI_Driver::init() {
 		LOGI("TFT_eSPI", "Initializing");
 		tft.init();
+
+		#if TFT_ESPI_DMA_FLUSH
+		// CS stays under TFT_eSPI control (startWrite() holds it low across strips).
+		dmaEnabled = tft.initDMA();
+		if (dmaEnabled) {
+				LOGI("TFT_eSPI", "DMA flush enabled");
+		} else {
+				LOGW("TFT_eSPI", "DMA init failed - using blocking flush");
+		}
+		#endif
 		
 		#if HAS_BACKLIGHT
 		// Initialize PWM for backlight control
@@ -17,11 +39,13 @@ void TFT_eSPI_Driver::init() {
 		// ESP32 Arduino Core 3.x uses new LEDC API
 		#if ESP_ARDUINO_VERSION_MAJOR >= 3
 		double actualFreq = ledcAttach(TFT_BL, TFT_BACKLIGHT_PWM_FREQ, 8);  // pin, freq, resolution (8-bit)
+		backlightFader.begin(TFT_BL);
 		LOGI("TFT_eSPI", "PWM attached, actual freq: %.1f Hz", actualFreq);
 		#else
 		// ESP32 Arduino Core 2.x uses old LEDC API
 		ledcSetup(TFT_BACKLIGHT_PWM_CHANNEL, TFT_BACKLIGHT_PWM_FREQ, 8);  // channel, freq, resolution
 		ledcAttachPin(TFT_BL, TFT_BACKLIGHT_PWM_CHANNEL);
+		backlightFader.begin(TFT_BACKLIGHT_PWM_CHANNEL);
 		LOGI("TFT_eSPI", "PWM setup complete (channel %d)", TFT_BACKLIGHT_PWM_CHANNEL);
 		#endif
 		
@@ -54,6 +78,7 @@ void TFT_eSPI_Driver::setBacklight(bool on) {
 }
 
 void TFT_eSPI_Driver::setBacklightBrightness(uint8_t brightness) {
+		backlightFader.cancel();  // A direct write ends any running fade
 		#if HAS_BACKLIGHT
 		// Clamp brightness to 0-100 range
 		if (brightness > 100) brightness = 100;
@@ -84,6 +109,7 @@ void TFT_eSPI_Driver::setBacklightBrightness(uint8_t brightness) {
 }
 
 uint8_t TFT_eSPI_Driver::getBacklightBrightness() {
+		if (backlightFader.active()) return backlightFader.brightness();
 		#if HAS_BACKLIGHT
 		return currentBrightness;
 		#else
@@ -99,6 +125,30 @@ bool TFT_eSPI_Driver::hasBacklightControl() {
 		#endif
 }
 
+bool TFT_eSPI_Driver::fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) {
+		#if HAS_BACKLIGHT && BACKLIGHT_FADE_ENGINE
+		if (to > 100) to = 100;
+		if (!backlightFader.start(from, to, duration_ms)) return false;
+		currentBrightness = to;
+		return true;
+		#else
+		return false;
+		#endif
+}
+
+bool TFT_eSPI_Driver::backlightFading() const {
+		return backlightFader.active();
+}
+
+bool TFT_eSPI_Driver::setPanelSleep(bool sleep) {
+		// MIPI DCS SLPIN / SLPOUT (GRAM is retained). The controller needs 5 ms
+		// after SLPIN and 120 ms after SLPOUT before it accepts pixel data.
+		dmaFinish();
+		tft.writecommand(sleep ? 0x10 : 0x11);
+		delay(sleep ? 5 : 120);
+		return true;
+}
+
 void TFT_eSPI_Driver::applyDisplayFixes() {
 		// Apply display-specific settings (inversion, gamma, etc.)
 		#ifdef DISPLAY_INVERSION_ON
@@ -124,17 +174,110 @@ void TFT_eSPI_Driver::applyDisplayFixes() {
 }
 
 void TFT_eSPI_Driver::startWrite() {
+		if (dmaEnabled) {
+				// TFT_eSPI's startWrite()/endWrite() wait for DMA, so the bus is
+				// claimed once and kept: the display has the SPI host to itself.
+				if (!busHeld) {
+						tft.startWrite();
+						busHeld = true;
+				}
+				return;
+		}
 		tft.startWrite();
 }
 
 void TFT_eSPI_Driver::endWrite() {
+		if (dmaEnabled) return;  // Transfer still running; see startWrite()
 		tft.endWrite();
 }
 
 void TFT_eSPI_Driver::setAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+		if (dmaEnabled) {
+				// Applied in pushColors(), once the previous strip is off the bus.
+				winX = x;
+				winY = y;
+				winW = w;
+				winH = h;
+				return;
+		}
 		tft.setAddrWindow(x, y, w, h);
 }
 
 void TFT_eSPI_Driver::pushColors(uint16_t* data, uint32_t len, bool swap_bytes) {
-		tft.pushColors(data, len, swap_bytes);
+		if (!dmaEnabled) {
+				tft.pushColors(data, len, swap_bytes);
+				return;
+		}
+
+		if (!esp_ptr_dma_capable(data)) {
+				dmaFinish();
+				tft.setAddrWindow(winX, winY, winW, winH);
+				tft.pushColors(data, len, swap_bytes);
+				return;
+		}
+
+		// Swap in place with the word kernel (the LVGL buffer is ours until
+		// flush-ready) instead of pushImageDMA()'s per-pixel loop. This strip is
+		// never the one in flight, so the swap overlaps the previous transfer.
+		if (swap_bytes) rgb565_swap_copy(data, data, len);
+		dmaFinish();
+		tft.setSwapBytes(false);
+		tft.pushImageDMA(winX, winY, winW, winH, data);
+		dmaQueuedUs = esp_timer_get_time();
+		#ifdef SPI_FREQUENCY
+		dmaWireEstUs = (uint32_t)((uint64_t)len * 16 * 1000000 / SPI_FREQUENCY);
+		#else
+		dmaWireEstUs = 0;
+		#endif
+}
+
+// Wait for the strip in flight and account for how much of it overlapped
+// with rendering. A transfer already done on entry ended at an unknown time
+// before it, so its wire time is capped at the SPI_FREQUENCY estimate.
+void TFT_eSPI_Driver::dmaFinish() {
+		if (!dmaQueuedUs) return;
+		const int64_t enter_us = esp_timer_get_time();
+		const bool busy = tft.dmaBusy();
+		if (busy) tft.dmaWait();
+		const int64_t done_us = esp_timer_get_time();
+
+		const uint32_t span_us = (uint32_t)(enter_us - dmaQueuedUs);
+		const uint32_t stall_us = busy ? (uint32_t)(done_us - enter_us) : 0;
+		uint32_t wire_us = span_us + stall_us;
+		if (!busy && dmaWireEstUs && dmaWireEstUs < span_us) wire_us = dmaWireEstUs;
+		dmaQueuedUs = 0;
+
+		portENTER_CRITICAL(&dmaStatsMux);
+		dmaStats.transfers++;
+		if (busy) dmaStats.waits++;
+		dmaStats.wire_us += wire_us;
+		dmaStats.stall_us += stall_us;
+		portEXIT_CRITICAL(&dmaStatsMux);
+}
+
+// TFT_eSPI has no DMA completion interrupt. LVGL calls this before it
+// reuses a draw buffer still marked as flushing and clears the flag itself
+// afterwards, so the wait lands exactly where rendering would overrun.
+void TFT_eSPI_Driver::flushWaitCallback(lv_display_t* disp) {
+		TFT_eSPI_Driver* self = (TFT_eSPI_Driver*)lv_display_get_driver_data(disp);
+		if (self) self->dmaFinish();
+}
+
+void TFT_eSPI_Driver::configureLVGL(lv_display_t* disp, uint8_t rotation) {
+		if (!dmaEnabled) return;
+		lv_display_set_driver_data(disp, this);
+		lv_display_set_flush_wait_cb(disp, flushWaitCallback);
+		LOGI("TFT_eSPI", "DMA flush wait callback registered");
+}
+
+bool TFT_eSPI_Driver::asyncFlush() const {
+		return dmaEnabled;
+}
+
+bool TFT_eSPI_Driver::flushDmaStats(FlushDmaStats* out) {
+		if (!out || !dmaEnabled) return false;
+		portENTER_CRITICAL(&dmaStatsMux);
+		*out = dmaStats;
+		portEXIT_CRITICAL(&dmaStatsMux);
+		return true;
 }
@@ -10,12 +10,27 @@
 
 #include "../display_driver.h"
 #include "../board_config.h"
+#include "backlight_fader.h"
 #include <TFT_eSPI.h>
 
 class TFT_eSPI_Driver : public DisplayDriver {
 private:
 		TFT_eSPI tft;
 		uint8_t currentBrightness;  // Current brightness level (0-100%)
+		BacklightFader backlightFader;  // BACKLIGHT_FADE_ENGINE ramps
+
+		// TFT_ESPI_DMA_FLUSH state (LVGL task only, except the stats)
+		bool dmaEnabled;
+		bool busHeld;           // startWrite() issued; kept open across DMA strips
+		int16_t winX, winY;     // Address window for the next pushColors()
+		uint16_t winW, winH;
+		int64_t dmaQueuedUs;    // Start of the transfer in flight (0 = none)
+		uint32_t dmaWireEstUs;  // Its wire time at SPI_FREQUENCY
+		FlushDmaStats dmaStats;
+		portMUX_TYPE dmaStatsMux;
+
+		void dmaFinish();
+		static void flushWaitCallback(lv_display_t* disp);
 		
 public:
 		TFT_eSPI_Driver();
@@ -29,12 +44,19 @@ public:
 		void setBacklightBrightness(uint8_t brightness) override;  // 0-100%
 		uint8_t getBacklightBrightness() override;
 		bool hasBacklightControl() override;
+		bool fadeBacklight(uint8_t from, uint8_t to, uint16_t duration_ms) override;
+		bool backlightFading() const override;
+		bool setPanelSleep(bool sleep) override;
 		void applyDisplayFixes() override;
 		
 		void startWrite() override;
 		void endWrite() override;
 		void setAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
 		void pushColors(uint16_t* data, uint32_t len, bool swap_bytes = true) override;
+
+		void configureLVGL(lv_display_t* disp, uint8_t rotation) override;
+		bool asyncFlush() const override;
+		bool flushDmaStats(FlushDmaStats* out) override;
 };
 
 #endif // TFT_ESPI_DRIVER_H
@@ -16,6 +16,7 @@
 #define WIRE_CST816S_TOUCH_DRIVER_H
 
 #include "../touch_driver.h"
+#include "../board_config.h"
 #include <Wire.h>
 
 class Wire_CST816S_TouchDriver : public TouchDriver {
@@ -31,6 +32,10 @@ public:
 		void setCalibration(uint16_t x_min, uint16_t x_max, uint16_t y_min, uint16_t y_max) override;
 		void setRotation(uint8_t rotation) override;
 
+		#if defined(TOUCH_INT)
+		int interruptPin() const override { return TOUCH_INT; }
+		#endif
+
 private:
 		TwoWire* wire;
 		uint8_t rotation;
@@ -46,6 +46,14 @@ void ha_discovery_publish_health(MqttManager &mqtt) {
 		ha_discovery_publish_sensor_config(mqtt, "display_fps", "Display FPS", "{{ value_json.display_fps }}", "fps", "", "measurement", "diagnostic");
 		ha_discovery_publish_sensor_config(mqtt, "display_lv_timer_us", "Display LV Timer", "{{ value_json.display_lv_timer_us }}", "us", "", "measurement", "diagnostic");
 		ha_discovery_publish_sensor_config(mqtt, "display_present_us", "Display Present", "{{ value_json.display_present_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_lv_timer_p99_us", "Display LV Timer p99", "{{ value_json.display_lv_timer_p99_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_lv_timer_max_us", "Display LV Timer Max", "{{ value_json.display_lv_timer_max_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_flush_p99_us", "Display Flush p99", "{{ value_json.display_flush_p99_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_flush_max_us", "Display Flush Max", "{{ value_json.display_flush_max_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_present_p99_us", "Display Present p99", "{{ value_json.display_present_p99_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_present_max_us", "Display Present Max", "{{ value_json.display_present_max_us }}", "us", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_bytes_per_frame", "Display Bytes/Frame", "{{ value_json.display_bytes_per_frame }}", "B", "", "measurement", "diagnostic");
+		ha_discovery_publish_sensor_config(mqtt, "display_lvgl_idle_pct", "Display LVGL Idle", "{{ value_json.display_lvgl_idle_pct }}", "%", "", "measurement", "diagnostic");
 		#endif
 
 		ha_discovery_publish_sensor_config(mqtt, "wifi_rssi", "WiFi RSSI", "{{ value_json.wifi_rssi }}", "dBm", "signal_strength", "measurement", "diagnostic");
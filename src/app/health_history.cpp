@@ -21,6 +21,7 @@ static HealthHistorySample* g_hist_samples = nullptr;
 static size_t g_hist_capacity = 0;
 static size_t g_hist_head = 0; // next write index
 static size_t g_hist_count = 0;
+static uint32_t g_hist_boot_id = 0;
 
 static void* hist_alloc(size_t bytes) {
 		if (bytes == 0) return nullptr;
@@ -110,6 +111,9 @@ void health_history_start() {
 		g_hist_capacity = (size_t)HEALTH_HISTORY_SAMPLES;
 		g_hist_head = 0;
 		g_hist_count = 0;
+		do {
+				g_hist_boot_id = esp_random();
+		} while (g_hist_boot_id == 0);
 
 		const size_t bytes = g_hist_capacity * sizeof(HealthHistorySample);
 		g_hist_samples = (HealthHistorySample*)hist_alloc(bytes);
@@ -168,6 +172,7 @@ HealthHistoryParams health_history_params() {
 		p.period_ms = (uint32_t)HEALTH_HISTORY_PERIOD_MS;
 		p.seconds = (uint32_t)HEALTH_HISTORY_SECONDS;
 		p.samples = (uint32_t)g_hist_capacity;
+		p.boot_id = g_hist_boot_id;
 		return p;
 }
 
@@ -204,6 +209,33 @@ bool health_history_get_sample(size_t index, HealthHistorySample* out_sample) {
 		return true;
 }
 
+size_t health_history_snapshot(HealthHistorySample* out, size_t max_samples, uint32_t since_uptime_ms) {
+		if (!out || max_samples == 0) return 0;
+		if (!health_history_available()) return 0;
+
+		portENTER_CRITICAL(&g_hist_mux);
+		const size_t c = g_hist_count;
+		const size_t cap = g_hist_capacity;
+		const size_t head = g_hist_head;
+
+		// Walk back from the newest sample; uptime_ms is monotonic (wrap-safe compare).
+		size_t n = 0;
+		while (n < c && n < max_samples) {
+				const size_t pos = (head + cap - 1 - n) % cap;
+				if (since_uptime_ms != 0 && (int32_t)(g_hist_samples[pos].uptime_ms - since_uptime_ms) <= 0) break;
+				n++;
+		}
+
+		// The n newest samples, copied as at most two contiguous runs.
+		const size_t first = (head + cap - n) % cap;
+		const size_t run = (first + n <= cap) ? n : cap - first;
+		memcpy(out, &g_hist_samples[first], run * sizeof(HealthHistorySample));
+		memcpy(out + run, &g_hist_samples[0], (n - run) * sizeof(HealthHistorySample));
+
+		portEXIT_CRITICAL(&g_hist_mux);
+		return n;
+}
+
 #else
 
 void health_history_start() {}
@@ -221,4 +253,6 @@ size_t health_history_capacity() { return 0; }
 
 bool health_history_get_sample(size_t, HealthHistorySample*) { return false; }
 
+size_t health_history_snapshot(HealthHistorySample*, size_t, uint32_t) { return 0; }
+
 #endif
@@ -10,6 +10,7 @@ struct HealthHistoryParams {
 		uint32_t period_ms;
 		uint32_t seconds;
 		uint32_t samples;
+		uint32_t boot_id;  // Random per boot (never 0): clients tell a reboot from uptime alone
 };
 
 struct HealthHistorySample {
@@ -47,3 +48,7 @@ size_t health_history_capacity();
 
 // Copy the i-th oldest sample (0..count-1). Returns false if out of range/unavailable.
 bool health_history_get_sample(size_t index, HealthHistorySample* out_sample);
+
+// Copy up to max_samples of the newest samples taken after since_uptime_ms
+// (0 = all), oldest first, in one critical section. Returns the number copied.
+size_t health_history_snapshot(HealthHistorySample* out, size_t max_samples, uint32_t since_uptime_ms);
@@ -67,8 +67,22 @@
  *=========================*/
 
 /* LV_OS_NONE: LVGL does not create internal render threads.
- * Thread safety is managed by DisplayManager's manual FreeRTOS mutex. */
-#define LV_USE_OS   LV_OS_NONE
+ * Thread safety is managed by DisplayManager's manual FreeRTOS mutex.
+ *
+ * Boards that set LVGL_DRAW_SW_UNITS > 1 switch to LV_OS_FREERTOS so the
+ * SW draw units can run as threads on both cores.  DisplayManager's mutex
+ * stays the outer lock for all LVGL access; LVGL's own global lock (taken
+ * inside lv_timer_handler) is then always uncontended. */
+#if defined(LVGL_DRAW_SW_UNITS) && LVGL_DRAW_SW_UNITS > 1
+    #define LV_USE_OS   LV_OS_FREERTOS
+
+    /* Draw-unit sync via semaphores, not direct-to-task notifications: the
+     * LVGL task's notification slot belongs to the idle scheduler
+     * (DisplayManager::wake()), and a stray give would end a draw wait early. */
+    #define LV_USE_FREERTOS_TASK_NOTIFY 0
+#else
+    #define LV_USE_OS   LV_OS_NONE
+#endif
 
 /*=========================
    DRAW / RENDERING
@@ -89,8 +103,17 @@
 #define LV_USE_DRAW_SW 1
 #if LV_USE_DRAW_SW == 1
     /* Number of SW draw units.  1 = inline rendering (no thread dispatch).
-     * Multi-unit threading regressed FPS on P4 (PSRAM bandwidth bottleneck). */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+     * Multi-unit threading regressed FPS on P4 (PSRAM bandwidth bottleneck);
+     * S3 boards with internal-SRAM draw buffers can opt in per board via
+     * LVGL_DRAW_SW_UNITS (measure with the fps_complex benchmark screen). */
+    #if defined(LVGL_DRAW_SW_UNITS) && LVGL_DRAW_SW_UNITS > 1
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    LVGL_DRAW_SW_UNITS
+
+        /* Stack for each draw-unit thread (bytes). */
+        #define LV_DRAW_THREAD_STACK_SIZE   (8 * 1024)
+    #else
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
 
     /* Enable complex drawing (shadows, gradients, etc.) */
     #define LV_DRAW_SW_COMPLEX          1
@@ -0,0 +1,251 @@
+#include "board_config.h"
+
+#if HAS_DISPLAY
+
+#include "lvgl_asset_decoder.h"
+#include "asset_codec.h"
+#include "log_manager.h"
+
+#include <lvgl.h>
+#include <draw/lv_image_decoder_private.h>  // lv_image_decoder_dsc_t fields
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Distinct compressed images kept at once (the byte budget usually binds first).
+#define ASSET_CACHE_SLOTS 16
+
+struct AssetCacheEntry {
+		const lv_image_dsc_t* src;  // nullptr = free slot
+		uint8_t* data;
+		uint32_t bytes;
+		uint32_t refs;              // Open decoder descriptors (pinned while > 0)
+		uint32_t lastUsed;
+		lv_draw_buf_t buf;
+};
+
+// Image larger than the whole budget: decoded per open, freed on close.
+struct AssetTransient {
+		uint8_t* data;
+		lv_draw_buf_t buf;
+};
+
+static AssetCacheEntry g_entries[ASSET_CACHE_SLOTS] = {};
+static SemaphoreHandle_t g_cache_mutex = nullptr;
+static StaticSemaphore_t g_cache_mutex_buf;
+static volatile bool g_ready = false;
+static uint32_t g_use_clock = 0;
+static uint32_t g_cache_bytes = 0;
+
+static LvglAssetCacheStats g_stats = {};
+static uint64_t g_decode_us_total = 0;
+
+static inline bool is_compressed_asset(const lv_image_decoder_dsc_t* dsc) {
+		if (dsc->src_type != LV_IMAGE_SRC_VARIABLE) return false;
+		const lv_image_dsc_t* img = (const lv_image_dsc_t*)dsc->src;
+		return (img->header.flags & LV_IMAGE_FLAGS_USER1)
+				&& img->header.cf == LV_COLOR_FORMAT_RGB565A8
+				&& img->data && img->data_size >= ASSET_BLOB_HEADER_SIZE;
+}
+
+static uint8_t* alloc_pixels(size_t size) {
+		uint8_t* p = (uint8_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		if (!p) {
+				p = (uint8_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		}
+		return p;
+}
+
+// Decode img into a fresh buffer; records miss/decode time. Caller holds the mutex.
+static uint8_t* decode_image(const lv_image_dsc_t* img, const AssetBlobInfo* info) {
+		uint8_t* data = alloc_pixels(info->raw_size);
+		if (!data) {
+				g_stats.errors++;
+				LOGW("Assets", "No memory for %lu-byte image", (unsigned long)info->raw_size);
+				return nullptr;
+		}
+
+		const int64_t t0 = esp_timer_get_time();
+		if (!asset_blob_decode(info, data, info->raw_size)) {
+				heap_caps_free(data);
+				g_stats.errors++;
+				LOGE("Assets", "Corrupt compressed image %p", img);
+				return nullptr;
+		}
+		const uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+
+		g_stats.misses++;
+		g_decode_us_total += us;
+		if (us > g_stats.decode_us_max) g_stats.decode_us_max = us;
+		return data;
+}
+
+// Make room for `bytes` by dropping least recently used unpinned entries.
+// Returns a free slot, or nullptr when pinned entries leave no room.
+static AssetCacheEntry* reserve_slot(uint32_t bytes) {
+		for (;;) {
+				AssetCacheEntry* free_slot = nullptr;
+				AssetCacheEntry* lru = nullptr;
+				for (AssetCacheEntry& e : g_entries) {
+						if (!e.src) {
+								if (!free_slot) free_slot = &e;
+						} else if (e.refs == 0 && (!lru || (int32_t)(e.lastUsed - lru->lastUsed) < 0)) {
+								lru = &e;
+						}
+				}
+				if (free_slot && g_cache_bytes + bytes <= LVGL_ASSET_CACHE_BYTES) return free_slot;
+				if (!lru) return nullptr;
+
+				heap_caps_free(lru->data);
+				g_cache_bytes -= lru->bytes;
+				*lru = {};
+				g_stats.evictions++;
+		}
+}
+
+static lv_result_t asset_info(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc, lv_image_header_t* header) {
+		LV_UNUSED(decoder);
+		if (!is_compressed_asset(dsc)) return LV_RESULT_INVALID;
+		*header = ((const lv_image_dsc_t*)dsc->src)->header;
+		return LV_RESULT_OK;
+}
+
+static lv_result_t asset_open(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc) {
+		LV_UNUSED(decoder);
+		if (!is_compressed_asset(dsc)) return LV_RESULT_INVALID;
+		const lv_image_dsc_t* img = (const lv_image_dsc_t*)dsc->src;
+		const lv_image_header_t* h = &img->header;
+
+		AssetBlobInfo info;
+		if (!asset_blob_parse(img->data, img->data_size, &info)
+				|| info.raw_size != (uint32_t)h->stride * h->h + (uint32_t)h->w * h->h) {
+				return LV_RESULT_INVALID;
+		}
+
+		xSemaphoreTake(g_cache_mutex, portMAX_DELAY);
+
+		for (AssetCacheEntry& e : g_entries) {
+				if (e.src == img) {
+						e.refs++;
+						e.lastUsed = ++g_use_clock;
+						g_stats.hits++;
+						dsc->decoded = &e.buf;
+						dsc->user_data = &e;
+						xSemaphoreGive(g_cache_mutex);
+						return LV_RESULT_OK;
+				}
+		}
+
+		const bool fits = info.raw_size <= LVGL_ASSET_CACHE_BYTES;
+		AssetCacheEntry* slot = fits ? reserve_slot(info.raw_size) : nullptr;
+		uint8_t* data = decode_image(img, &info);
+		if (!data) {
+				xSemaphoreGive(g_cache_mutex);
+				return LV_RESULT_INVALID;
+		}
+
+		if (slot) {
+				slot->src = img;
+				slot->data = data;
+				slot->bytes = info.raw_size;
+				slot->refs = 1;
+				slot->lastUsed = ++g_use_clock;
+				lv_draw_buf_init(&slot->buf, h->w, h->h, (lv_color_format_t)h->cf, h->stride, data, info.raw_size);
+				g_cache_bytes += info.raw_size;
+				dsc->decoded = &slot->buf;
+				dsc->user_data = slot;
+				xSemaphoreGive(g_cache_mutex);
+				return LV_RESULT_OK;
+		}
+
+		if (fits) {
+				g_stats.pinned_full++;
+		} else {
+				g_stats.oversize++;
+		}
+		xSemaphoreGive(g_cache_mutex);
+
+		AssetTransient* t = (AssetTransient*)heap_caps_malloc(sizeof(AssetTransient), MALLOC_CAP_8BIT);
+		if (!t) {
+				heap_caps_free(data);
+				return LV_RESULT_INVALID;
+		}
+		t->data = data;
+		lv_draw_buf_init(&t->buf, h->w, h->h, (lv_color_format_t)h->cf, h->stride, data, info.raw_size);
+		dsc->decoded = &t->buf;
+		dsc->user_data = t;
+		return LV_RESULT_OK;
+}
+
+static void asset_close(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc) {
+		LV_UNUSED(decoder);
+		void* handle = dsc->user_data;
+		if (!handle) return;
+		dsc->user_data = nullptr;
+
+		if (handle >= (void*)g_entries && handle < (void*)(g_entries + ASSET_CACHE_SLOTS)) {
+				xSemaphoreTake(g_cache_mutex, portMAX_DELAY);
+				AssetCacheEntry* e = (AssetCacheEntry*)handle;
+				if (e->refs > 0) e->refs--;
+				xSemaphoreGive(g_cache_mutex);
+				return;
+		}
+
+		AssetTransient* t = (AssetTransient*)handle;
+		heap_caps_free(t->data);
+		heap_caps_free(t);
+}
+
+bool lvgl_asset_decoder_init() {
+		if (g_ready) return true;
+		if (!g_cache_mutex) {
+				g_cache_mutex = xSemaphoreCreateMutexStatic(&g_cache_mutex_buf);
+		}
+
+		// Created after lv_init(), so it sits ahead of the built-in bin decoder
+		// and sees LV_IMAGE_SRC_VARIABLE images first.
+		lv_image_decoder_t* decoder = lv_image_decoder_create();
+		if (!decoder) {
+				LOGE("Assets", "Decoder create failed; compressed images disabled");
+				return false;
+		}
+		lv_image_decoder_set_info_cb(decoder, asset_info);
+		lv_image_decoder_set_open_cb(decoder, asset_open);
+		lv_image_decoder_set_close_cb(decoder, asset_close);
+		g_ready = true;
+		LOGI("Assets", "Compressed image decoder ready (cache %lu bytes)", (unsigned long)LVGL_ASSET_CACHE_BYTES);
+		return true;
+}
+
+bool lvgl_asset_decoder_ready() {
+		return g_ready;
+}
+
+const void* lvgl_asset_src(const void* img) {
+		if (!img || g_ready) return img;
+		if (lv_image_src_get_type(img) != LV_IMAGE_SRC_VARIABLE) return img;
+		if (((const lv_image_dsc_t*)img)->header.flags & LV_IMAGE_FLAGS_USER1) {
+				LOGW("Assets", "Compressed image %p skipped: decoder not ready", img);
+				return nullptr;
+		}
+		return img;
+}
+
+bool lvgl_asset_decoder_get_stats(LvglAssetCacheStats* out) {
+		if (!out || !g_cache_mutex) return false;
+
+		xSemaphoreTake(g_cache_mutex, portMAX_DELAY);
+		*out = g_stats;
+		uint32_t entries = 0;
+		for (const AssetCacheEntry& e : g_entries) {
+				if (e.src) entries++;
+		}
+		out->entries = entries;
+		out->bytes = g_cache_bytes;
+		out->decode_us_avg = g_stats.misses ? (uint32_t)(g_decode_us_total / g_stats.misses) : 0;
+		xSemaphoreGive(g_cache_mutex);
+		return true;
+}
+
+#endif // HAS_DISPLAY
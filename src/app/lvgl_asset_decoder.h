@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+// LVGL image decoder for compressed PNG assets (tools/png2lvgl_assets.py --compress).
+//
+// Images flagged LV_IMAGE_FLAGS_USER1 carry an asset_codec.h blob instead of raw
+// RGB565A8 planes. The decoder inflates them into a cache (PSRAM preferred)
+// bounded by LVGL_ASSET_CACHE_BYTES; entries in use by a draw are pinned, the
+// least recently opened unpinned ones are evicted. An image larger than the
+// whole budget is decoded per draw and freed again (counted as oversize), as
+// is one that does not fit because every cached entry is pinned (pinned_full).
+//
+// LVGL's built-in decoder would read a flagged blob as raw RGB565A8 planes and
+// run past the array, so compressed images must not reach a widget unless the
+// decoder is registered: set them through lvgl_asset_src().
+
+struct LvglAssetCacheStats {
+		uint32_t hits;
+		uint32_t misses;          // Decodes (including oversize ones)
+		uint32_t evictions;
+		uint32_t oversize;        // Decoded without caching: larger than the budget
+		uint32_t pinned_full;     // Decoded without caching: every entry pinned
+		uint32_t errors;          // Malformed blob or allocation failure
+		uint32_t entries;
+		uint32_t bytes;           // Decoded bytes currently cached
+		uint32_t decode_us_avg;
+		uint32_t decode_us_max;
+};
+
+// Register the decoder. Call once, after lv_init(). Returns false (and
+// lvgl_asset_src() rejects compressed images) if it could not be registered.
+bool lvgl_asset_decoder_init();
+
+bool lvgl_asset_decoder_ready();
+
+// Image source for lv_image_set_src(): img itself, or nullptr for a compressed
+// (LV_IMAGE_FLAGS_USER1) lv_image_dsc_t when the decoder is not ready.
+const void* lvgl_asset_src(const void* img);
+
+bool lvgl_asset_decoder_get_stats(LvglAssetCacheStats* out);
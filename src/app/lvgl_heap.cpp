@@ -6,14 +6,37 @@
  * the user must supply these symbols.
  *
  * Allocation strategy: PSRAM first → internal 8-bit RAM fallback.
+ *
+ * Bytes currently held by LVGL are counted per region (PSRAM / internal)
+ * from the heap's own block sizes, so DisplayManager can measure what a
+ * screen's widget tree costs (lvgl_heap_get_usage()).
  */
 
 #include "lvgl_heap.h"
 
 #include <lvgl.h>          // lv_mem_monitor_t, lv_mem_pool_t, lv_result_t, LV_UNUSED
 #include <esp_heap_caps.h>
+#include <esp_memory_utils.h>  // esp_ptr_external_ram
 #include <string.h>        // memset
 
+// Live LVGL bytes per region (relaxed atomics: LVGL draw units may allocate
+// from their own threads).
+static size_t g_lvgl_psram_bytes = 0;
+static size_t g_lvgl_internal_bytes = 0;
+
+static inline size_t* usage_counter(const void* p) {
+		return esp_ptr_external_ram(p) ? &g_lvgl_psram_bytes : &g_lvgl_internal_bytes;
+}
+
+static inline void usage_add(void* p) {
+		if (!p) return;
+		__atomic_fetch_add(usage_counter(p), heap_caps_get_allocated_size(p), __ATOMIC_RELAXED);
+}
+
+static inline void usage_sub(const void* p, size_t size) {
+		__atomic_fetch_sub(usage_counter(p), size, __ATOMIC_RELAXED);
+}
+
 static inline bool psram_available() {
 #if SOC_SPIRAM_SUPPORTED
 		return heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0;
@@ -29,12 +52,15 @@ static inline bool psram_available() {
 extern "C" void* lv_malloc_core(size_t size) {
 		if (size == 0) return nullptr;
 
+		void* p = nullptr;
 		if (psram_available()) {
-				void* p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-				if (p) return p;
+				p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
 		}
-
-		return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		if (!p) {
+				p = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		}
+		usage_add(p);
+		return p;
 }
 
 extern "C" void* lv_realloc_core(void* ptr, size_t new_size) {
@@ -44,19 +70,35 @@ extern "C" void* lv_realloc_core(void* ptr, size_t new_size) {
 				return nullptr;
 		}
 
+		// Sample the old block before realloc may free it.
+		const size_t old_size = heap_caps_get_allocated_size(ptr);
+		size_t* old_counter = usage_counter(ptr);
+
+		void* p = nullptr;
 		if (psram_available()) {
-				void* p = heap_caps_realloc(ptr, new_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-				if (p) return p;
+				p = heap_caps_realloc(ptr, new_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
 		}
-
-		return heap_caps_realloc(ptr, new_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		if (!p) {
+				p = heap_caps_realloc(ptr, new_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		}
+		if (p) {
+				__atomic_fetch_sub(old_counter, old_size, __ATOMIC_RELAXED);
+				usage_add(p);
+		}
+		return p;
 }
 
 extern "C" void lv_free_core(void* ptr) {
 		if (!ptr) return;
+		usage_sub(ptr, heap_caps_get_allocated_size(ptr));
 		heap_caps_free(ptr);
 }
 
+extern "C" void lvgl_heap_get_usage(size_t* psram_bytes, size_t* internal_bytes) {
+		if (psram_bytes) *psram_bytes = __atomic_load_n(&g_lvgl_psram_bytes, __ATOMIC_RELAXED);
+		if (internal_bytes) *internal_bytes = __atomic_load_n(&g_lvgl_internal_bytes, __ATOMIC_RELAXED);
+}
+
 // ---------------------------------------------------------------------------
 // Lifecycle / diagnostics (required by LV_STDLIB_CUSTOM contract)
 // ---------------------------------------------------------------------------
@@ -5,8 +5,7 @@
  * are defined in lvgl_heap.cpp and linked directly — no header inclusion
  * needed by LVGL since v9 discovers them at link time.
  *
- * This header is retained ONLY so existing #include "lvgl_heap.h" sites
- * continue to compile without changes.
+ * Also exposes the allocator's live usage counters (lvgl_heap_get_usage).
  */
 
 #pragma once
@@ -23,6 +22,10 @@ void* lv_malloc_core(size_t size);
 void* lv_realloc_core(void* ptr, size_t new_size);
 void  lv_free_core(void* ptr);
 
+/* Bytes currently allocated through LVGL, split by region (heap block sizes,
+ * so slightly above the requested sizes).  Either pointer may be NULL. */
+void lvgl_heap_get_usage(size_t* psram_bytes, size_t* internal_bytes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -107,7 +107,7 @@ void MqttManager::publishDiscoveryOncePerBoot() {
 void MqttManager::publishHealthNow() {
 		if (!_client.connected()) return;
 
-		StaticJsonDocument<768> doc;
+		StaticJsonDocument<1024> doc;
 		const MqttPublishScope scope = power_config_parse_mqtt_publish_scope(_config);
 		device_telemetry_fill_mqtt_scoped(doc, scope);
 
@@ -135,7 +135,7 @@ void MqttManager::publishHealthIfDue() {
 		unsigned long interval_ms = (unsigned long)_config->cycle_interval_seconds * 1000UL;
 
 		if (_last_health_publish_ms == 0 || (now - _last_health_publish_ms) >= interval_ms) {
-				StaticJsonDocument<768> doc;
+				StaticJsonDocument<1024> doc;
 				const MqttPublishScope scope = power_config_parse_mqtt_publish_scope(_config);
 				device_telemetry_fill_mqtt_scoped(doc, scope);
 
@@ -8,7 +8,7 @@
 
 // PubSubClient uses MQTT_MAX_PACKET_SIZE at compile time
 #ifndef MQTT_MAX_PACKET_SIZE
-#define MQTT_MAX_PACKET_SIZE 1024
+#define MQTT_MAX_PACKET_SIZE 1536
 #endif
 
 #include <WiFi.h>
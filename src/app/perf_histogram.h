@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdint.h>
+
+// Fixed-bucket log2 duration histogram (microseconds).
+//
+// Design goals:
+// - Lock-free updates from the render tasks (one relaxed atomic add per sample,
+//   plus a CAS loop only when a new maximum is seen).
+// - Lock-free drain from any task: each bucket is atomically swapped with 0, so
+//   a sample lands either in this window or the next — never lost or doubled.
+// - Percentiles are bucket upper bounds (at most 2x high), clamped to the exact
+//   window maximum. Good enough to separate "steady 8 ms" from "8 ms with 60 ms
+//   spikes", which is what an average hides.
+//
+// Bucket 0 holds 0 us; bucket i (i >= 1) holds [2^(i-1), 2^i) us. The last
+// bucket is open-ended (>= 2^(PERF_HIST_BUCKETS-2) us, ~4 s with 24 buckets).
+
+#define PERF_HIST_BUCKETS 24
+
+struct PerfHistogram {
+		uint32_t buckets[PERF_HIST_BUCKETS];
+		uint32_t max_us;
+};
+
+// Summary of one drained window.
+struct PerfPercentiles {
+		uint32_t count;   // Samples in the window (0 = no data)
+		uint32_t p50_us;
+		uint32_t p95_us;
+		uint32_t p99_us;
+		uint32_t max_us;
+};
+
+static inline uint8_t perf_hist_bucket(uint32_t us) {
+		if (us == 0) return 0;
+		const uint8_t b = (uint8_t)(32 - __builtin_clz(us));
+		return b < PERF_HIST_BUCKETS ? b : (PERF_HIST_BUCKETS - 1);
+}
+
+static inline void perf_hist_record(PerfHistogram* h, uint32_t us) {
+		__atomic_fetch_add(&h->buckets[perf_hist_bucket(us)], 1, __ATOMIC_RELAXED);
+
+		uint32_t cur = __atomic_load_n(&h->max_us, __ATOMIC_RELAXED);
+		while (us > cur) {
+				if (__atomic_compare_exchange_n(&h->max_us, &cur, us, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+		}
+}
+
+// Percentiles of one snapshot of bucket counts.
+static inline void perf_hist_summarize(const uint32_t* counts, uint32_t max_us, PerfPercentiles* out) {
+		uint32_t total = 0;
+		for (uint8_t i = 0; i < PERF_HIST_BUCKETS; i++) total += counts[i];
+
+		out->count = total;
+		out->max_us = max_us;
+		out->p50_us = 0;
+		out->p95_us = 0;
+		out->p99_us = 0;
+		if (total == 0) return;
+
+		// Rank thresholds (ceil(q * total)), in ascending order.
+		const uint32_t rank50 = (total * 50 + 99) / 100;
+		const uint32_t rank95 = (total * 95 + 99) / 100;
+		const uint32_t rank99 = (total * 99 + 99) / 100;
+
+		uint32_t seen = 0;
+		bool have50 = false, have95 = false;
+		for (uint8_t i = 0; i < PERF_HIST_BUCKETS; i++) {
+				if (counts[i] == 0) continue;
+				seen += counts[i];
+				// Upper bound of bucket i, clamped to the observed maximum.
+				uint32_t upper = (i == 0) ? 0 : ((1u << i) - 1);
+				if (i == PERF_HIST_BUCKETS - 1 || upper > max_us) upper = max_us;
+				if (!have50 && seen >= rank50) { out->p50_us = upper; have50 = true; }
+				if (!have95 && seen >= rank95) { out->p95_us = upper; have95 = true; }
+				if (seen >= rank99) { out->p99_us = upper; break; }
+		}
+}
+
+// Drain all samples recorded since the previous drain and summarize them.
+static inline void perf_hist_take(PerfHistogram* h, PerfPercentiles* out) {
+		uint32_t counts[PERF_HIST_BUCKETS];
+		for (uint8_t i = 0; i < PERF_HIST_BUCKETS; i++) {
+				counts[i] = __atomic_exchange_n(&h->buckets[i], 0, __ATOMIC_RELAXED);
+		}
+		perf_hist_summarize(counts, __atomic_exchange_n(&h->max_us, 0, __ATOMIC_RELAXED), out);
+}
+
+// Summarize without draining, for sparse events accumulated until perf_hist_reset().
+static inline void perf_hist_peek(const PerfHistogram* h, PerfPercentiles* out) {
+		uint32_t counts[PERF_HIST_BUCKETS];
+		for (uint8_t i = 0; i < PERF_HIST_BUCKETS; i++) {
+				counts[i] = __atomic_load_n(&h->buckets[i], __ATOMIC_RELAXED);
+		}
+		perf_hist_summarize(counts, __atomic_load_n(&h->max_us, __ATOMIC_RELAXED), out);
+}
+
+static inline void perf_hist_reset(PerfHistogram* h) {
+		PerfPercentiles discard;
+		perf_hist_take(h, &discard);
+}
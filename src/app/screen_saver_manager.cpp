@@ -24,6 +24,7 @@ uint32_t g_fade_start_ms = 0;
 uint32_t g_fade_duration_ms = 0;
 uint8_t g_fade_from = 0;
 uint8_t g_fade_to = 0;
+bool g_fade_in_driver = false;  // Ramp handed to DisplayDriver::fadeBacklight()
 
 uint8_t g_current_brightness = 100;
 uint8_t g_target_brightness = 100;
@@ -79,6 +80,16 @@ static void apply_brightness(uint8_t brightness) {
 		}
 }
 
+// Hand the whole ramp to the driver (BACKLIGHT_FADE_ENGINE); false = step it here.
+static bool start_driver_fade(uint8_t from, uint8_t to, uint16_t duration_ms) {
+		#if BACKLIGHT_FADE_ENGINE
+		if (!displayManager || !displayManager->getDriver()) return false;
+		return displayManager->getDriver()->fadeBacklight(from, to, duration_ms);
+		#else
+		return false;
+		#endif
+}
+
 static void start_fade(ScreenSaverState newState, uint8_t from, uint8_t to, uint16_t duration_ms) {
 		g_state = newState;
 		g_fade_start_ms = millis();
@@ -87,6 +98,8 @@ static void start_fade(ScreenSaverState newState, uint8_t from, uint8_t to, uint
 		g_fade_to = to;
 		g_target_brightness = to;
 
+		g_fade_in_driver = false;
+
 		// If duration is 0, apply immediately.
 		if (duration_ms == 0) {
 				g_current_brightness = to;
@@ -95,8 +108,13 @@ static void start_fade(ScreenSaverState newState, uint8_t from, uint8_t to, uint
 				return;
 		}
 
-		// Apply the starting brightness right away to avoid a one-loop delay.
 		g_current_brightness = from;
+		g_fade_in_driver = start_driver_fade(from, to, duration_ms);
+		if (g_fade_in_driver) {
+				return;
+		}
+
+		// Apply the starting brightness right away to avoid a one-loop delay.
 		apply_brightness(from);
 }
 
@@ -188,6 +206,20 @@ static void update_fade() {
 				return;
 		}
 
+		// Driver-run ramp: only track it. Brightness is already at the target
+		// when it ends (or a direct setBacklightBrightness() cancelled it).
+		if (g_fade_in_driver) {
+				DisplayDriver* driver = displayManager ? displayManager->getDriver() : nullptr;
+				if (driver && driver->backlightFading()) {
+						g_current_brightness = driver->getBacklightBrightness();
+						return;
+				}
+				g_fade_in_driver = false;
+				g_current_brightness = g_fade_to;
+				g_state = (g_fade_to == 0) ? ScreenSaverState::Asleep : ScreenSaverState::Awake;
+				return;
+		}
+
 		const uint32_t now = millis();
 		const uint32_t elapsed = now - g_fade_start_ms;
 
@@ -320,6 +352,16 @@ void screen_saver_manager_loop() {
 				prev_force = force;
 		}
 		#endif
+
+		#if DISPLAY_SLEEP_RENDER_OFF
+		// Nothing is visible while asleep: stop rendering until the wake fade starts.
+		static bool prev_asleep = false;
+		const bool asleep = (g_state == ScreenSaverState::Asleep);
+		if (asleep != prev_asleep) {
+				display_manager_set_render_sleep(asleep);
+				prev_asleep = asleep;
+		}
+		#endif
 }
 
 void screen_saver_manager_notify_activity(bool wake) {
@@ -3,11 +3,16 @@
 #include "../board_config.h"
 #include "../display_manager.h"
 
-FpsScreen::FpsScreen(DisplayManager* manager)
+// Complex-scene card grid.
+static const uint8_t kComplexCols = 3;
+static const uint8_t kComplexRows = 4;
+
+FpsScreen::FpsScreen(DisplayManager* manager, bool complex)
 		: screen(nullptr), displayMgr(manager),
 			fpsValueLabel(nullptr), fpsUnitLabel(nullptr),
 			presentLabel(nullptr), renderLabel(nullptr), frameLabel(nullptr),
-			arc(nullptr), arcAngle(0) {}
+			unitsLabel(nullptr), arc(nullptr), complexScene(complex), arcAngle(0),
+			fpsBinding{}, presentBinding{}, renderBinding{} {}
 
 FpsScreen::~FpsScreen() {
 		destroy();
@@ -18,9 +23,17 @@ void FpsScreen::create() {
 
 		LOGI("FpsScreen", "Create start");
 
+		ui_binding_reset(&fpsBinding);
+		ui_binding_reset(&presentBinding);
+		ui_binding_reset(&renderBinding);
+
 		screen = lv_obj_create(NULL);
 		lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
 
+		if (complexScene) {
+				createComplexScene();
+		}
+
 		// --- Spinning arc (centered, behind text) ---
 		arc = lv_arc_create(screen);
 		lv_obj_set_size(arc, 120, 120);
@@ -74,9 +87,50 @@ void FpsScreen::create() {
 		lv_obj_align(frameLabel, LV_ALIGN_CENTER, 0, 91);
 		lv_obj_clear_flag(frameLabel, LV_OBJ_FLAG_CLICKABLE);
 
+		// Compile-time renderer config, so screenshots/logs are self-describing.
+		unitsLabel = lv_label_create(screen);
+		lv_label_set_text_fmt(unitsLabel, "Draw units: %d", (int)LV_DRAW_SW_DRAW_UNIT_CNT);
+		lv_obj_set_style_text_color(unitsLabel, lv_color_hex(0x777777), 0);
+		lv_obj_set_style_text_font(unitsLabel, &lv_font_montserrat_14, 0);
+		lv_obj_align(unitsLabel, LV_ALIGN_CENTER, 0, 109);
+		lv_obj_clear_flag(unitsLabel, LV_OBJ_FLAG_CLICKABLE);
+
 		LOGI("FpsScreen", "Create complete");
 }
 
+void FpsScreen::createComplexScene() {
+		// Vertical gradient over the whole screen.
+		lv_obj_set_style_bg_color(screen, lv_color_hex(0x101830), 0);
+		lv_obj_set_style_bg_grad_color(screen, lv_color_hex(0x301020), 0);
+		lv_obj_set_style_bg_grad_dir(screen, LV_GRAD_DIR_VER, 0);
+
+		// Card grid: every card has a radius, shadow, border, gradient and
+		// partial opacity, which are the expensive SW draw paths.
+		// Positions are percentages so the grid fills any resolution (no flex layout).
+		for (uint8_t i = 0; i < kComplexCols * kComplexRows; i++) {
+				const uint8_t col = i % kComplexCols;
+				const uint8_t row = i / kComplexCols;
+				lv_obj_t* card = lv_obj_create(screen);
+				lv_obj_remove_style_all(card);
+				lv_obj_set_size(card, lv_pct(28), lv_pct(21));
+				lv_obj_set_pos(card, lv_pct(4 + col * 32), lv_pct(2 + row * 24));
+				lv_obj_set_style_radius(card, 12, 0);
+				lv_obj_set_style_bg_opa(card, LV_OPA_70, 0);
+				lv_obj_set_style_bg_color(card, lv_color_hsv_to_rgb((uint16_t)(i * 30), 70, 80), 0);
+				lv_obj_set_style_bg_grad_color(card, lv_color_hsv_to_rgb((uint16_t)((i * 30 + 60) % 360), 80, 40), 0);
+				lv_obj_set_style_bg_grad_dir(card, LV_GRAD_DIR_HOR, 0);
+				lv_obj_set_style_border_width(card, 2, 0);
+				lv_obj_set_style_border_color(card, lv_color_white(), 0);
+				lv_obj_set_style_border_opa(card, LV_OPA_40, 0);
+				lv_obj_set_style_shadow_width(card, 16, 0);
+				lv_obj_set_style_shadow_spread(card, 2, 0);
+				lv_obj_set_style_shadow_color(card, lv_color_black(), 0);
+				lv_obj_set_style_shadow_opa(card, LV_OPA_60, 0);
+				lv_obj_clear_flag(card, LV_OBJ_FLAG_CLICKABLE);
+				lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+		}
+}
+
 void FpsScreen::destroy() {
 		if (screen) {
 				lv_obj_delete(screen);
@@ -86,6 +140,7 @@ void FpsScreen::destroy() {
 				presentLabel = nullptr;
 				renderLabel = nullptr;
 				frameLabel = nullptr;
+				unitsLabel = nullptr;
 				arc = nullptr;
 		}
 }
@@ -106,33 +161,38 @@ void FpsScreen::update() {
 
 		// Advance the spinning arc every frame.
 		// The arc step is large enough to be visible even at low FPS.
+		// lv_arc_set_angles() invalidates only the arc, which keeps a frame
+		// in flight every tick; the labels below invalidate themselves.
 		arcAngle = (arcAngle + 15) % 360;
 		lv_arc_set_angles(arc, arcAngle, arcAngle + 90);
 
-		// Force LVGL to redraw the entire screen every frame.
-		// This ensures we measure the maximum achievable panel refresh rate
-		// rather than only counting frames with organic UI changes.
-		lv_obj_invalidate(lv_screen_active());
-
-		// Read perf stats (updated every ~1s by the render/present task).
+		// Read perf stats (updated every ~1s by the render/present task) and
+		// only reformat the labels whose displayed value changed.
 		DisplayPerfStats stats;
 		if (display_manager_get_perf_stats(&stats)) {
 				char buf[32];
 
-				snprintf(buf, sizeof(buf), "%u", stats.fps);
-				lv_label_set_text(fpsValueLabel, buf);
-
-				uint32_t present_ms = (stats.present_us + 500) / 1000;
-				uint32_t render_ms  = (stats.lv_timer_us + 500) / 1000;
-				uint32_t frame_ms   = present_ms + render_ms;
-
-				snprintf(buf, sizeof(buf), "Present:  %lu ms", (unsigned long)present_ms);
-				lv_label_set_text(presentLabel, buf);
-
-				snprintf(buf, sizeof(buf), "Render:   %lu ms", (unsigned long)render_ms);
-				lv_label_set_text(renderLabel, buf);
-
-				snprintf(buf, sizeof(buf), "Frame:    %lu ms", (unsigned long)frame_ms);
-				lv_label_set_text(frameLabel, buf);
+				if (ui_binding_changed(&fpsBinding, stats.fps)) {
+						snprintf(buf, sizeof(buf), "%u", stats.fps);
+						lv_label_set_text(fpsValueLabel, buf);
+				}
+
+				const uint32_t present_ms = (stats.present_us + 500) / 1000;
+				const uint32_t render_ms  = (stats.lv_timer_us + 500) / 1000;
+				const bool presentChanged = ui_binding_changed(&presentBinding, present_ms);
+				const bool renderChanged = ui_binding_changed(&renderBinding, render_ms);
+
+				if (presentChanged) {
+						snprintf(buf, sizeof(buf), "Present:  %lu ms", (unsigned long)present_ms);
+						lv_label_set_text(presentLabel, buf);
+				}
+				if (renderChanged) {
+						snprintf(buf, sizeof(buf), "Render:   %lu ms", (unsigned long)render_ms);
+						lv_label_set_text(renderLabel, buf);
+				}
+				if (presentChanged || renderChanged) {
+						snprintf(buf, sizeof(buf), "Frame:    %lu ms", (unsigned long)(present_ms + render_ms));
+						lv_label_set_text(frameLabel, buf);
+				}
 		}
 }
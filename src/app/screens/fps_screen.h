@@ -2,6 +2,7 @@
 #define FPS_SCREEN_H
 
 #include "screen.h"
+#include "../ui_binding.h"
 #include <lvgl.h>
 
 // Forward declaration
@@ -14,6 +15,10 @@ class DisplayManager;
 // Displays live panel FPS, present() time, and LVGL render time.
 // A spinning arc provides visual confirmation that redraws are happening.
 // Navigate to/from this screen via the web portal screen API.
+//
+// Complex variant ("fps_complex"): adds a full-screen gradient and a grid of
+// rounded, shadowed, semi-transparent cards behind the stats, so render cost
+// is dominated by SW rasterisation. Used to compare LVGL_DRAW_SW_UNITS builds.
 
 class FpsScreen : public Screen {
 private:
@@ -26,13 +31,23 @@ private:
 		lv_obj_t* presentLabel;
 		lv_obj_t* renderLabel;
 		lv_obj_t* frameLabel;
+		lv_obj_t* unitsLabel;
 		lv_obj_t* arc;
+
+		// Complex-scene variant (see above)
+		bool complexScene;
+		void createComplexScene();
 		
 		// Arc animation state
 		uint16_t arcAngle;
+
+		// Stat label bindings (perf stats change at most once per ~1s window)
+		UiBinding fpsBinding;
+		UiBinding presentBinding;
+		UiBinding renderBinding;
 		
 public:
-		FpsScreen(DisplayManager* manager);
+		FpsScreen(DisplayManager* manager, bool complex = false);
 		~FpsScreen();
 		
 		void create() override;
@@ -40,6 +55,7 @@ public:
 		void show() override;
 		void hide() override;
 		void update() override;
+		lv_obj_t* root() const override { return screen; }
 };
 
 #endif // FPS_SCREEN_H
@@ -1,15 +1,15 @@
 #include "info_screen.h"
 #include "../../version.h"
 #include "log_manager.h"
-#include "../device_telemetry.h"
 #include "../board_config.h"
 #include "../display_manager.h"
-#include <WiFi.h>
+#include "../ui_state.h"
 #include <esp_chip_info.h>
 
-InfoScreen::InfoScreen(DeviceConfig* deviceConfig, DisplayManager* manager) 
-		: screen(nullptr), config(deviceConfig), displayMgr(manager),
-		lastUpdateMs(0),
+InfoScreen::InfoScreen(DisplayManager* manager) 
+		: screen(nullptr), displayMgr(manager),
+		nameBinding{}, mdnsBinding{}, ipBinding{}, uptimeBinding{}, heapBinding{}, cpuBinding{},
+		heapKb(0), cpuPct(UI_CPU_UNKNOWN),
 		deviceNameLabel(nullptr), mdnsLabel(nullptr), ipLabel(nullptr),
 		versionLabel(nullptr), uptimeLabel(nullptr), heapLabel(nullptr), chipLabel(nullptr) {}
 
@@ -20,6 +20,14 @@ InfoScreen::~InfoScreen() {
 void InfoScreen::create() {
 		if (screen) return;  // Already created
 		
+		// Fresh labels: every binding must fire once on the first update().
+		ui_binding_reset(&nameBinding);
+		ui_binding_reset(&mdnsBinding);
+		ui_binding_reset(&ipBinding);
+		ui_binding_reset(&uptimeBinding);
+		ui_binding_reset(&heapBinding);
+		ui_binding_reset(&cpuBinding);
+		
 		// Create main screen container
 		screen = lv_obj_create(NULL);
 		// Override theme background to pure black
@@ -130,72 +138,57 @@ void InfoScreen::hide() {
 void InfoScreen::update() {
 		if (!screen) return;
 
-		// This method is called from the LVGL task loop, potentially every 1-10ms.
-		// Avoid constant label rewrites/invalidation: update at a modest cadence.
-		const uint32_t now = millis();
-		const uint32_t kUpdateIntervalMs = 500;
-		if (lastUpdateMs != 0 && (uint32_t)(now - lastUpdateMs) < kUpdateIntervalMs) {
-				return;
+		// Called from the LVGL task loop, potentially every 1-10ms. Each label is
+		// bound to a versioned value (ui_state.h) and only formatted/rewritten
+		// when that value changed, so an unchanged screen invalidates nothing.
+		char text[UI_TEXT_MAX];
+
+		if (deviceNameLabel && ui_text_take(&g_ui_state.device_name, &nameBinding, text, sizeof(text))) {
+				lv_label_set_text(deviceNameLabel, text);
 		}
-		lastUpdateMs = now;
-		
-		// Update device name (from config)
-		if (deviceNameLabel) {
-				if (strlen(config->device_name) > 0) {
-						lv_label_set_text(deviceNameLabel, config->device_name);
-				} else {
-						lv_label_set_text(deviceNameLabel, "ESP32 Device");
-				}
+
+		if (mdnsLabel && ui_text_take(&g_ui_state.mdns_host, &mdnsBinding, text, sizeof(text))) {
+				lv_label_set_text(mdnsLabel, text);
 		}
-		
-		// Update uptime (formatted)
+
+		if (ipLabel && ui_text_take(&g_ui_state.ip, &ipBinding, text, sizeof(text))) {
+				lv_label_set_text(ipLabel, text);
+		}
+
+		// Uptime: bound to the value at the granularity it is shown
+		// (seconds for the first hour, then minutes).
 		if (uptimeLabel) {
-				unsigned long uptime_sec = millis() / 1000;
-				char uptime_text[32];
-				if (uptime_sec < 60) {
-						snprintf(uptime_text, sizeof(uptime_text), "%lus", uptime_sec);
-				} else if (uptime_sec < 3600) {
-						snprintf(uptime_text, sizeof(uptime_text), "%lum %lus", uptime_sec / 60, uptime_sec % 60);
-				} else {
-						unsigned long hours = uptime_sec / 3600;
-						unsigned long mins = (uptime_sec % 3600) / 60;
-						snprintf(uptime_text, sizeof(uptime_text), "%luh %lum", hours, mins);
+				const unsigned long uptime_sec = millis() / 1000;
+				const uint32_t key = uptime_sec < 3600 ? (uint32_t)uptime_sec : (uint32_t)(3600 + uptime_sec / 60);
+				if (ui_binding_changed(&uptimeBinding, key)) {
+						char uptime_text[32];
+						if (uptime_sec < 60) {
+								snprintf(uptime_text, sizeof(uptime_text), "%lus", uptime_sec);
+						} else if (uptime_sec < 3600) {
+								snprintf(uptime_text, sizeof(uptime_text), "%lum %lus", uptime_sec / 60, uptime_sec % 60);
+						} else {
+								unsigned long hours = uptime_sec / 3600;
+								unsigned long mins = (uptime_sec % 3600) / 60;
+								snprintf(uptime_text, sizeof(uptime_text), "%luh %lum", hours, mins);
+						}
+						lv_label_set_text(uptimeLabel, uptime_text);
 				}
-				lv_label_set_text(uptimeLabel, uptime_text);
 		}
-		
-		// Update free heap with CPU usage
+
+		// Free heap with CPU usage (one label, two sources)
 		if (heapLabel) {
-				char heap_text[64];
-				unsigned long heap_kb = ESP.getFreeHeap() / 1024;
-				const int cpu_usage = device_telemetry_get_cpu_usage();
-				if (cpu_usage >= 0) {
-						snprintf(heap_text, sizeof(heap_text), "%lu KB free / %d%% CPU", heap_kb, cpu_usage);
-				} else {
-						snprintf(heap_text, sizeof(heap_text), "%lu KB free / --%% CPU", heap_kb);
-				}
-				lv_label_set_text(heapLabel, heap_text);
-		}
-		
-		// Update IP address
-		if (ipLabel) {
-				if (WiFi.status() == WL_CONNECTED) {
-						lv_label_set_text(ipLabel, WiFi.localIP().toString().c_str());
-				} else if (WiFi.getMode() == WIFI_AP) {
-						lv_label_set_text(ipLabel, WiFi.softAPIP().toString().c_str());
-				} else {
-						lv_label_set_text(ipLabel, "No IP");
+				const bool heapChanged = ui_value_take(&g_ui_state.heap_free_kb, &heapBinding, &heapKb);
+				const bool cpuChanged = ui_value_take(&g_ui_state.cpu_pct, &cpuBinding, &cpuPct);
+				if (heapChanged || cpuChanged) {
+						char heap_text[64];
+						if (cpuPct != UI_CPU_UNKNOWN) {
+								snprintf(heap_text, sizeof(heap_text), "%lu KB free / %lu%% CPU", (unsigned long)heapKb, (unsigned long)cpuPct);
+						} else {
+								snprintf(heap_text, sizeof(heap_text), "%lu KB free / --%% CPU", (unsigned long)heapKb);
+						}
+						lv_label_set_text(heapLabel, heap_text);
 				}
 		}
-		
-		// Update mDNS hostname
-		if (mdnsLabel) {
-				char sanitized[CONFIG_DEVICE_NAME_MAX_LEN];
-				config_manager_sanitize_device_name(config->device_name, sanitized, sizeof(sanitized));
-				char mdns_text[CONFIG_DEVICE_NAME_MAX_LEN + 10];
-				snprintf(mdns_text, sizeof(mdns_text), "%s.local", sanitized);
-				lv_label_set_text(mdnsLabel, mdns_text);
-		}
 }
 
 // Touch event callback - navigate to TestScreen
@@ -2,7 +2,7 @@
 #define INFO_SCREEN_H
 
 #include "screen.h"
-#include "../config_manager.h"
+#include "../ui_binding.h"
 #include <lvgl.h>
 
 // Forward declaration
@@ -17,10 +17,17 @@ class DisplayManager;
 class InfoScreen : public Screen {
 private:
 		lv_obj_t* screen;
-		DeviceConfig* config;
 		DisplayManager* displayMgr;
 
-		uint32_t lastUpdateMs;
+		// Label bindings (ui_state.h): labels are rewritten only on change
+		UiBinding nameBinding;
+		UiBinding mdnsBinding;
+		UiBinding ipBinding;
+		UiBinding uptimeBinding;
+		UiBinding heapBinding;
+		UiBinding cpuBinding;
+		uint32_t heapKb;
+		uint32_t cpuPct;
 		
 		// Labels (updated in real-time)
 		lv_obj_t* deviceNameLabel;
@@ -40,7 +47,7 @@ private:
 		static void touchEventCallback(lv_event_t* e);
 		
 public:
-		InfoScreen(DeviceConfig* deviceConfig, DisplayManager* manager);
+		InfoScreen(DisplayManager* manager);
 		~InfoScreen();
 		
 		void create() override;
@@ -48,6 +55,7 @@ public:
 		void show() override;
 		void hide() override;
 		void update() override;
+		lv_obj_t* root() const override { return screen; }
 };
 
 #endif // INFO_SCREEN_H
@@ -1,6 +1,8 @@
 #ifndef SCREEN_H
 #define SCREEN_H
 
+#include <lvgl.h>
+
 // ============================================================================
 // Screen Base Class
 // ============================================================================
@@ -33,6 +35,10 @@ public:
 		// Update screen data (called every loop while active)
 		// Read from stored pointers (thread-safe: main loop only)
 		virtual void update() = 0;
+
+		// Root LVGL object while created (nullptr otherwise). Lets DisplayManager
+		// resolve a pre-warmed screen's layout before it is shown.
+		virtual lv_obj_t* root() const { return nullptr; }
 };
 
 #endif // SCREEN_H
@@ -26,6 +26,7 @@ public:
 		void show() override;
 		void hide() override;
 		void update() override;
+		lv_obj_t* root() const override { return screen; }
 		
 		// Update status text (e.g., "Initializing WiFi...")
 		void setStatus(const char* text);
@@ -41,6 +41,7 @@ public:
 		void show() override;
 		void hide() override;
 		void update() override;
+		lv_obj_t* root() const override { return screen; }
 };
 
 #endif // TEST_SCREEN_H
@@ -5,12 +5,13 @@
 #include "../board_config.h"
 #include "../log_manager.h"
 #include "../touch_manager.h"
+#include "../display_manager.h"
 
 #include <stdlib.h>  // abs()
 
 TouchTestScreen::TouchTestScreen()
 		: screen(nullptr), canvas(nullptr), canvasBuf(nullptr),
-			headerLabel(nullptr),
+			headerLabel(nullptr), latencyLabel(nullptr), lastLatencyMs(0), lastLatencySeen(0),
 				prevTouchValid(false), prevX(0), prevY(0), brushRadius(3),
 			canvasWidth(0), canvasHeight(0) {}
 
@@ -47,6 +48,15 @@ void TouchTestScreen::create() {
 		lv_obj_align(headerLabel, LV_ALIGN_TOP_MID, 0, 4);
 		lv_obj_clear_flag(headerLabel, LV_OBJ_FLAG_CLICKABLE);
 
+		// Latency label — same style, bottom-center
+		latencyLabel = lv_label_create(screen);
+		lv_label_set_text(latencyLabel, "");
+		lv_obj_set_style_text_color(latencyLabel, lv_color_make(80, 80, 80), 0);
+		lv_obj_set_style_text_font(latencyLabel, &lv_font_montserrat_14, 0);
+		lv_obj_set_style_text_align(latencyLabel, LV_TEXT_ALIGN_CENTER, 0);
+		lv_obj_align(latencyLabel, LV_ALIGN_BOTTOM_MID, 0, -4);
+		lv_obj_clear_flag(latencyLabel, LV_OBJ_FLAG_CLICKABLE);
+
 		// Canvas is NOT allocated here — deferred to show() to save PSRAM.
 
 		LOGI("TouchTest", "Create complete (brush r=%d)", brushRadius);
@@ -65,6 +75,7 @@ void TouchTestScreen::destroy() {
 				lv_obj_delete(screen);
 				screen = nullptr;
 				headerLabel = nullptr;
+				latencyLabel = nullptr;
 		}
 }
 
@@ -118,8 +129,14 @@ void TouchTestScreen::show() {
 		lv_obj_add_event_cb(canvas, touchEventCallback, LV_EVENT_PRESSING, this);
 		lv_obj_add_event_cb(canvas, touchEventCallback, LV_EVENT_RELEASED, this);
 
-		// Move header label to front (above canvas)
+		// Move labels to front (above canvas)
 		lv_obj_move_to_index(headerLabel, -1);
+		lv_obj_move_to_index(latencyLabel, -1);
+
+		// Fresh latency numbers for this session
+		display_manager_reset_input_latency();
+		lastLatencySeen = UINT32_MAX;
+		lastLatencyMs = 0;
 
 		// Reset touch tracking
 		prevTouchValid = false;
@@ -153,7 +170,29 @@ void TouchTestScreen::hide() {
 }
 
 void TouchTestScreen::update() {
-		// No periodic updates needed — drawing happens in touch event callback
+		// Drawing happens in the touch event callback; only the latency line is
+		// refreshed here, at most twice a second and only when a new sample landed.
+		if (!latencyLabel || !canvas) return;
+		const uint32_t now = millis();
+		if (now - lastLatencyMs < 500) return;
+		lastLatencyMs = now;
+
+		DisplayInputLatency lat;
+		if (!display_manager_get_input_latency(&lat)) return;
+		const uint32_t seen = lat.presses + lat.touch_present.count + lat.unmatched;
+		if (seen == lastLatencySeen) return;
+		lastLatencySeen = seen;
+
+		if (lat.touch_flush.count == 0) {
+				lv_label_set_text(latencyLabel, "Tap to measure touch latency");
+				return;
+		}
+		lv_label_set_text_fmt(latencyLabel,
+				"touch>flush p50 %lu p95 %lu ms\n"
+				"touch>panel p50 %lu p95 %lu ms  last %lu  n=%lu",
+				(unsigned long)(lat.touch_flush.p50_us / 1000), (unsigned long)(lat.touch_flush.p95_us / 1000),
+				(unsigned long)(lat.touch_present.p50_us / 1000), (unsigned long)(lat.touch_present.p95_us / 1000),
+				(unsigned long)(lat.last_present_us / 1000), (unsigned long)lat.touch_present.count);
 }
 
 // ============================================================================
@@ -23,6 +23,9 @@
 // Navigation: Only via web portal (/api/display/screen with "touch_test").
 // All touch input goes to drawing — no touch-based exit.
 // Canvas is cleared each time the screen is shown.
+//
+// The bottom line shows touch-to-flush / touch-to-present latency
+// (p50/p95 and the last press), reset each time the screen is shown.
 
 class TouchTestScreen : public Screen {
 private:
@@ -31,6 +34,10 @@ private:
 	uint8_t* canvasBuf;  // PSRAM-allocated RGB565 buffer, owned by this screen
 		// Header label (screen name + resolution)
 		lv_obj_t* headerLabel;
+		// Live touch-to-photon latency (bottom line), refreshed from update()
+		lv_obj_t* latencyLabel;
+		uint32_t lastLatencyMs;
+		uint32_t lastLatencySeen;
 
 		// Previous touch point for line interpolation
 		bool prevTouchValid;
@@ -62,6 +69,7 @@ public:
 		void show() override;
 		void hide() override;
 		void update() override;
+		lv_obj_t* root() const override { return screen; }
 };
 
 #endif // HAS_TOUCH
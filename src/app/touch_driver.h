@@ -16,6 +16,12 @@
 
 #include <Arduino.h>
 
+// One contact in screen space (see TouchDriver::getTouchPoints).
+struct TouchPoint {
+		uint16_t x;
+		uint16_t y;
+};
+
 // ============================================================================
 // Touch Driver Interface
 // ============================================================================
@@ -51,6 +57,21 @@ public:
 		// Set rotation to match display orientation
 		// 0=portrait, 1=landscape, 2=portrait_flip, 3=landscape_flip
 		virtual void setRotation(uint8_t rotation) = 0;
+
+		// Multi-touch read (pinch in TOUCH_GESTURES)
+		// Fills up to max contacts, primary first, mapped like getTouch().
+		// Returns the number of contacts (0 = released). Single-touch
+		// controllers keep the default, which wraps getTouch().
+		virtual uint8_t getTouchPoints(TouchPoint* points, uint8_t max) {
+				if (max == 0) return 0;
+				return getTouch(&points[0].x, &points[0].y) ? 1 : 0;
+		}
+
+		// Interrupt-driven sampling (TOUCH_INT_SAMPLING)
+		// GPIO the controller pulses when it has new touch data, or -1 when
+		// it is not wired (or the driver already consumes it internally).
+		// TouchManager then reads the controller only after an edge.
+		virtual int interruptPin() const { return -1; }
 };
 
 #endif // TOUCH_DRIVER_H
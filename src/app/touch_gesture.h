@@ -0,0 +1,336 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Touch sample filtering (TOUCH_FILTER) and gesture recognition
+// (TOUCH_GESTURES), run by TouchManager on every LVGL indev read.
+// Header-only with no Arduino dependencies, so recorded touch traces can be
+// replayed through the same code on the host.
+//
+// Filter, per axis, in this order:
+//   1. Median of the last 3 raw samples: drops single-sample spikes.
+//   2. One-euro low-pass: heavy smoothing while the finger rests, little lag
+//      while it moves fast (cutoff grows with speed).
+//   3. Deadband: the output holds until the filtered point moves more than
+//      deadband_px, so a resting finger reports a perfectly still point.
+//
+// Gestures are a table-driven state machine (kTouchGestureTable): each feed
+// derives one event from the contact state, and the (state, event) row gives
+// the next state and an action. Taps are left to LVGL.
+
+// ============================================================================
+// Filter
+// ============================================================================
+
+struct TouchFilterConfig {
+		float min_cutoff_hz;  // Cutoff at rest (lower = smoother, more lag)
+		float beta;           // Cutoff increase per px/s of speed (higher = less lag when fast)
+		float d_cutoff_hz;    // Cutoff for the speed estimate
+		uint8_t deadband_px;  // Output holds until the point moves further than this
+};
+
+static const TouchFilterConfig kTouchFilterDefaults = {1.0f, 0.01f, 1.0f, 2};
+
+struct TouchAxisFilter {
+		int16_t hist[3];
+		float value;
+		float deriv;
+};
+
+struct TouchFilter {
+		TouchFilterConfig cfg;
+		TouchAxisFilter ax;
+		TouchAxisFilter ay;
+		uint8_t samples;   // Since the press, saturating (0 = released)
+		uint8_t slot;      // Next median history slot
+		uint32_t last_us;
+		int16_t out_x;
+		int16_t out_y;
+};
+
+static inline void touch_filter_init(TouchFilter* f, const TouchFilterConfig* cfg) {
+		*f = {};
+		f->cfg = *cfg;
+}
+
+// Call on release so the next press starts from its own first sample.
+static inline void touch_filter_reset(TouchFilter* f) {
+		f->samples = 0;
+}
+
+static inline int16_t touch_median3(int16_t a, int16_t b, int16_t c) {
+		if (a > b) { const int16_t t = a; a = b; b = t; }
+		if (b > c) b = c;
+		return a > b ? a : b;
+}
+
+static inline float touch_euro_alpha(float cutoff_hz, float dt_s) {
+		const float tau = 1.0f / (6.2831853f * cutoff_hz);
+		return 1.0f / (1.0f + tau / dt_s);
+}
+
+static inline float touch_axis_step(TouchAxisFilter* a, const TouchFilterConfig* cfg, int16_t raw, uint8_t n, uint8_t slot, float dt_s) {
+		a->hist[slot] = raw;
+		const float x = (n >= 2) ? (float)touch_median3(a->hist[0], a->hist[1], a->hist[2]) : (float)raw;
+		if (n == 0) {
+				a->value = x;
+				a->deriv = 0.0f;
+				return x;
+		}
+		const float dx = (x - a->value) / dt_s;
+		a->deriv += touch_euro_alpha(cfg->d_cutoff_hz, dt_s) * (dx - a->deriv);
+		const float cutoff = cfg->min_cutoff_hz + cfg->beta * fabsf(a->deriv);
+		a->value += touch_euro_alpha(cutoff, dt_s) * (x - a->value);
+		return a->value;
+}
+
+// Filter one pressed sample in place. t_us: capture time (wraps freely).
+static inline void touch_filter_apply(TouchFilter* f, uint32_t t_us, int16_t* x, int16_t* y) {
+		const uint8_t n = f->samples;
+		uint32_t dt_us = t_us - f->last_us;
+		if (n == 0 || dt_us == 0) dt_us = 1000;
+		if (dt_us > 100000) dt_us = 100000;  // Stalled reads: don't let one step jump the whole way
+		const float dt_s = (float)dt_us * 1e-6f;
+		f->last_us = t_us;
+
+		if (n == 0) f->slot = 0;
+		const int16_t fx = (int16_t)lroundf(touch_axis_step(&f->ax, &f->cfg, *x, n, f->slot, dt_s));
+		const int16_t fy = (int16_t)lroundf(touch_axis_step(&f->ay, &f->cfg, *y, n, f->slot, dt_s));
+		f->slot = (uint8_t)((f->slot + 1) % 3);
+		if (f->samples < 255) f->samples++;
+
+		const int32_t mx = fx - f->out_x;
+		const int32_t my = fy - f->out_y;
+		const int32_t db = f->cfg.deadband_px;
+		if (n == 0 || mx * mx + my * my > db * db) {
+				f->out_x = fx;
+				f->out_y = fy;
+		}
+		*x = f->out_x;
+		*y = f->out_y;
+}
+
+// ============================================================================
+// Gestures
+// ============================================================================
+
+enum class TouchGestureType : uint8_t {
+		None = 0,
+		SwipeLeft,
+		SwipeRight,
+		SwipeUp,
+		SwipeDown,
+		LongPress,
+		PinchIn,
+		PinchOut,
+};
+
+struct TouchGesture {
+		TouchGestureType type;
+		int16_t x;             // Start point (pinch: midpoint of the two contacts)
+		int16_t y;
+		int16_t dx;            // Swipe: end - start
+		int16_t dy;
+		uint16_t scale_pct;    // Pinch: final / initial finger distance x 100
+		uint32_t duration_ms;  // Press (swipe, long press) or pinch duration
+};
+
+struct TouchGestureConfig {
+		uint16_t slop_px;        // Movement still counted as "not moving" (tap / long press)
+		uint16_t swipe_min_px;   // Dominant-axis travel for a swipe
+		uint16_t swipe_max_ms;   // Slower drags are not swipes
+		uint16_t long_press_ms;  // Hold time within slop_px
+		uint8_t pinch_min_pct;   // Finger distance change for a pinch (% of the start)
+};
+
+static const TouchGestureConfig kTouchGestureDefaults = {10, 60, 600, 600, 15};
+
+enum class TouchGestureState : uint8_t { Idle, Pressed, Dragging, Pinching, Consumed };
+enum class TouchGestureEvent : uint8_t { None, Down, Up, Move, Hold, SecondDown, SecondUp };
+enum class TouchGestureAction : uint8_t { None, Begin, EmitLongPress, EndSwipe, BeginPinch, EndPinch };
+
+struct TouchGestureRule {
+		TouchGestureState state;
+		TouchGestureEvent event;
+		TouchGestureState next;
+		TouchGestureAction action;
+};
+
+// (state, event) -> next state + action. Pairs not listed keep the state.
+static const TouchGestureRule kTouchGestureTable[] = {
+		{TouchGestureState::Idle,     TouchGestureEvent::Down,       TouchGestureState::Pressed,  TouchGestureAction::Begin},
+		{TouchGestureState::Pressed,  TouchGestureEvent::Move,       TouchGestureState::Dragging, TouchGestureAction::None},
+		{TouchGestureState::Pressed,  TouchGestureEvent::Hold,       TouchGestureState::Consumed, TouchGestureAction::EmitLongPress},
+		{TouchGestureState::Pressed,  TouchGestureEvent::SecondDown, TouchGestureState::Pinching, TouchGestureAction::BeginPinch},
+		{TouchGestureState::Pressed,  TouchGestureEvent::Up,         TouchGestureState::Idle,     TouchGestureAction::None},
+		{TouchGestureState::Dragging, TouchGestureEvent::SecondDown, TouchGestureState::Pinching, TouchGestureAction::BeginPinch},
+		{TouchGestureState::Dragging, TouchGestureEvent::Up,         TouchGestureState::Idle,     TouchGestureAction::EndSwipe},
+		{TouchGestureState::Pinching, TouchGestureEvent::SecondUp,   TouchGestureState::Consumed, TouchGestureAction::EndPinch},
+		{TouchGestureState::Pinching, TouchGestureEvent::Up,         TouchGestureState::Idle,     TouchGestureAction::EndPinch},
+		{TouchGestureState::Consumed, TouchGestureEvent::Up,         TouchGestureState::Idle,     TouchGestureAction::None},
+};
+
+// Swipe direction by dominant axis and sign.
+struct TouchSwipeRule {
+		bool horizontal;
+		bool positive;
+		TouchGestureType type;
+};
+
+static const TouchSwipeRule kTouchSwipeTable[] = {
+		{true,  false, TouchGestureType::SwipeLeft},
+		{true,  true,  TouchGestureType::SwipeRight},
+		{false, false, TouchGestureType::SwipeUp},
+		{false, true,  TouchGestureType::SwipeDown},
+};
+
+struct TouchGestureRecognizer {
+		TouchGestureConfig cfg;
+		TouchGestureState state;
+		bool down;
+		bool second;
+		uint32_t start_ms;
+		int16_t start_x, start_y;
+		int16_t last_x, last_y;
+		uint32_t pinch_start_ms;
+		uint32_t pinch_d0;     // Finger distance at pinch start (px)
+		uint32_t pinch_d;      // Latest finger distance
+		int16_t pinch_mx, pinch_my;
+};
+
+static inline void touch_gesture_init(TouchGestureRecognizer* g, const TouchGestureConfig* cfg) {
+		*g = {};
+		g->cfg = *cfg;
+		g->state = TouchGestureState::Idle;
+}
+
+static inline uint32_t touch_gesture_dist(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+		const float dx = (float)(x1 - x0);
+		const float dy = (float)(y1 - y0);
+		return (uint32_t)lroundf(sqrtf(dx * dx + dy * dy));
+}
+
+// Feed one read (every indev poll, pressed or not). The secondary contact is
+// only looked at while the primary is down. Returns true and fills *out when
+// a gesture completes.
+static inline bool touch_gesture_feed(TouchGestureRecognizer* g, uint32_t t_ms,
+		bool pressed, int16_t x, int16_t y,
+		bool has_second, int16_t x2, int16_t y2,
+		TouchGesture* out) {
+		has_second = has_second && pressed;
+
+		if (pressed) {
+				g->last_x = x;
+				g->last_y = y;
+		}
+		if (has_second) {
+				g->pinch_d = touch_gesture_dist(x, y, x2, y2);
+		}
+
+		// Derive at most one event, most significant first.
+		TouchGestureEvent ev = TouchGestureEvent::None;
+		if (!pressed && g->down) {
+				ev = TouchGestureEvent::Up;
+		} else if (pressed && !g->down) {
+				ev = TouchGestureEvent::Down;
+		} else if (has_second && !g->second) {
+				ev = TouchGestureEvent::SecondDown;
+		} else if (!has_second && g->second) {
+				ev = TouchGestureEvent::SecondUp;
+		} else if (pressed && touch_gesture_dist(g->start_x, g->start_y, x, y) > g->cfg.slop_px) {
+				ev = TouchGestureEvent::Move;
+		} else if (pressed && t_ms - g->start_ms >= g->cfg.long_press_ms) {
+				ev = TouchGestureEvent::Hold;
+		}
+		g->down = pressed;
+		// A second contact present on the Down read is left unlatched, so the
+		// next read derives SecondDown for it (both fingers in one sample).
+		if (ev != TouchGestureEvent::Down) g->second = has_second;
+		if (ev == TouchGestureEvent::None) return false;
+
+		const TouchGestureRule* rule = nullptr;
+		for (const TouchGestureRule& r : kTouchGestureTable) {
+				if (r.state == g->state && r.event == ev) {
+						rule = &r;
+						break;
+				}
+		}
+		if (!rule) return false;
+		g->state = rule->next;
+
+		TouchGesture gst = {};
+		switch (rule->action) {
+				case TouchGestureAction::Begin:
+						g->start_ms = t_ms;
+						g->start_x = x;
+						g->start_y = y;
+						return false;
+
+				case TouchGestureAction::EmitLongPress:
+						gst.type = TouchGestureType::LongPress;
+						gst.x = g->start_x;
+						gst.y = g->start_y;
+						gst.duration_ms = t_ms - g->start_ms;
+						break;
+
+				case TouchGestureAction::EndSwipe: {
+						const int16_t dx = (int16_t)(g->last_x - g->start_x);
+						const int16_t dy = (int16_t)(g->last_y - g->start_y);
+						const bool horizontal = abs(dx) >= abs(dy);
+						const int16_t travel = (int16_t)abs(horizontal ? dx : dy);
+						const uint32_t duration = t_ms - g->start_ms;
+						if (travel < (int16_t)g->cfg.swipe_min_px || duration > g->cfg.swipe_max_ms) return false;
+						const bool positive = (horizontal ? dx : dy) > 0;
+						for (const TouchSwipeRule& r : kTouchSwipeTable) {
+								if (r.horizontal == horizontal && r.positive == positive) gst.type = r.type;
+						}
+						gst.x = g->start_x;
+						gst.y = g->start_y;
+						gst.dx = dx;
+						gst.dy = dy;
+						gst.duration_ms = duration;
+						break;
+				}
+
+				case TouchGestureAction::BeginPinch:
+						g->pinch_start_ms = t_ms;
+						g->pinch_d0 = g->pinch_d;
+						g->pinch_mx = (int16_t)((x + x2) / 2);
+						g->pinch_my = (int16_t)((y + y2) / 2);
+						return false;
+
+				case TouchGestureAction::EndPinch: {
+						if (g->pinch_d0 == 0) return false;
+						const uint32_t scale = g->pinch_d * 100 / g->pinch_d0;
+						const uint32_t band = g->cfg.pinch_min_pct;
+						if (scale + band > 100 && scale < 100 + band) return false;
+						gst.type = scale > 100 ? TouchGestureType::PinchOut : TouchGestureType::PinchIn;
+						gst.x = g->pinch_mx;
+						gst.y = g->pinch_my;
+						gst.scale_pct = (uint16_t)(scale < 65535 ? scale : 65535);
+						gst.duration_ms = t_ms - g->pinch_start_ms;
+						break;
+				}
+
+				default:
+						return false;
+		}
+
+		if (out) *out = gst;
+		return true;
+}
+
+static inline const char* touch_gesture_name(TouchGestureType type) {
+		switch (type) {
+				case TouchGestureType::SwipeLeft:  return "swipe_left";
+				case TouchGestureType::SwipeRight: return "swipe_right";
+				case TouchGestureType::SwipeUp:    return "swipe_up";
+				case TouchGestureType::SwipeDown:  return "swipe_down";
+				case TouchGestureType::LongPress:  return "long_press";
+				case TouchGestureType::PinchIn:    return "pinch_in";
+				case TouchGestureType::PinchOut:   return "pinch_out";
+				default:                           return "none";
+		}
+}
@@ -3,8 +3,11 @@
 #if HAS_TOUCH
 
 #include "touch_manager.h"
+#include "touch_gesture.h"
 #include "log_manager.h"
 
+#include <esp_timer.h>
+
 // Touch init may run while the LVGL rendering task is active.
 // LVGL is not thread-safe, so guard LVGL API calls with the DisplayManager mutex when available.
 #if HAS_DISPLAY
@@ -32,8 +35,50 @@ static uint32_t g_lvgl_suppress_until_ms = 0;
 static bool g_lvgl_force_released = false;
 static bool g_prev_lvgl_pressed = false;
 
+// Interrupt-driven sampling: the sampler task is the only I2C user and
+// publishes the latest point as one packed word, so readers never block.
+// Bits 0-14 x, 15-29 y, 31 pressed.
+#define TOUCH_SLOT_PRESSED 0x80000000u
+static uint32_t g_touch_slot = 0;
+static uint32_t g_touch_slot2 = 0;  // Second contact (TOUCH_GESTURES pinch), written before g_touch_slot
+static TaskHandle_t g_sampler_task = nullptr;
+static uint32_t g_touch_irqs = 0;
+static uint32_t g_touch_i2c_reads = 0;
+static uint32_t g_touch_cache_reads = 0;
+
+// Capture time (low 32 bits of esp_timer_get_time()) of the controller read
+// that saw the latest released -> pressed transition; written before the
+// slot. Moves while pressed leave it alone, so the latency of a press is
+// measured from the press, not from the last move before LVGL's poll.
+static uint32_t g_touch_press_us = 0;
+
+// Contacts read per sample: the second one only feeds pinch detection.
+#define TOUCH_READ_POINTS (TOUCH_GESTURES ? 2 : 1)
+
+#if TOUCH_FILTER
+static TouchFilter g_filter;
+#endif
+#if TOUCH_GESTURES
+static TouchGestureRecognizer g_gestures;
+static uint32_t g_gesture_event = 0;  // LVGL event code, registered with the indev
+static uint32_t g_gesture_count = 0;
+#endif
+
+static inline uint32_t touch_slot_pack(uint16_t x, uint16_t y, bool pressed) {
+		return (uint32_t)(x & 0x7FFF) | ((uint32_t)(y & 0x7FFF) << 15) | (pressed ? TOUCH_SLOT_PRESSED : 0);
+}
+
+// Latest sampled point; true while pressed.
+static inline bool touch_slot_read(uint16_t* x, uint16_t* y) {
+		const uint32_t v = __atomic_load_n(&g_touch_slot, __ATOMIC_ACQUIRE);
+		__atomic_fetch_add(&g_touch_cache_reads, 1, __ATOMIC_RELAXED);
+		if (x) *x = (uint16_t)(v & 0x7FFF);
+		if (y) *y = (uint16_t)((v >> 15) & 0x7FFF);
+		return (v & TOUCH_SLOT_PRESSED) != 0;
+}
+
 TouchManager::TouchManager() 
-		: driver(nullptr), indev(nullptr), lvglRegisterPending(false) {
+		: driver(nullptr), indev(nullptr), lvglRegisterPending(false), samplerTask(nullptr) {
 		// Driver will be instantiated in init() after display is ready
 }
 
@@ -52,11 +97,37 @@ void TouchManager::readCallback(lv_indev_t* indev, lv_indev_data_t* data) {
 		if (g_lvgl_force_released || ((int32_t)(g_lvgl_suppress_until_ms - now) > 0)) {
 				data->state = LV_INDEV_STATE_RELEASED;
 				g_prev_lvgl_pressed = false;
+				manager->processSample(now, 0, false, nullptr, nullptr, false, 0, 0);
 				return;
 		}
 		
 		uint16_t x, y;
-		if (manager->driver->getTouch(&x, &y)) {
+		uint16_t x2 = 0, y2 = 0;
+		bool second = false;
+		const uint32_t read_us = (uint32_t)esp_timer_get_time();
+		bool pressed;
+		if (manager->samplerTask) {
+				pressed = touch_slot_read(&x, &y);
+				const uint32_t v2 = __atomic_load_n(&g_touch_slot2, __ATOMIC_RELAXED);
+				second = pressed && (v2 & TOUCH_SLOT_PRESSED);
+				if (second) {
+						x2 = (uint16_t)(v2 & 0x7FFF);
+						y2 = (uint16_t)((v2 >> 15) & 0x7FFF);
+				}
+		} else {
+				TouchPoint pts[TOUCH_READ_POINTS] = {};
+				const uint8_t n = manager->driver->getTouchPoints(pts, TOUCH_READ_POINTS);
+				pressed = n > 0;
+				x = pts[0].x;
+				y = pts[0].y;
+				if (n > 1) {
+						second = true;
+						x2 = pts[1].x;
+						y2 = pts[1].y;
+				}
+		}
+		manager->processSample(now, read_us, pressed, &x, &y, second, x2, y2);
+		if (pressed) {
 				data->state = LV_INDEV_STATE_PRESSED;
 				data->point.x = x;
 				data->point.y = y;
@@ -68,6 +139,8 @@ void TouchManager::readCallback(lv_indev_t* indev, lv_indev_data_t* data) {
 				if (pressedEdge) {
 						#if HAS_DISPLAY
 						screen_saver_manager_notify_activity(false);
+						// INT mode: the press was captured by the sampler, not by this read.
+						display_manager_mark_input(manager->samplerTask ? __atomic_load_n(&g_touch_press_us, __ATOMIC_RELAXED) : read_us);
 						#endif
 				}
 		} else {
@@ -76,6 +149,51 @@ void TouchManager::readCallback(lv_indev_t* indev, lv_indev_data_t* data) {
 		}
 }
 
+// Filter the primary point in place and feed the gesture recognizer
+// (TOUCH_FILTER / TOUCH_GESTURES; no-op when both are off). LVGL task.
+void TouchManager::processSample(uint32_t now_ms, uint32_t read_us, bool pressed, uint16_t* x, uint16_t* y,
+		bool second, uint16_t x2, uint16_t y2) {
+		int16_t fx = (pressed && x) ? (int16_t)*x : 0;
+		int16_t fy = (pressed && y) ? (int16_t)*y : 0;
+
+		#if TOUCH_FILTER
+		if (pressed) {
+				touch_filter_apply(&g_filter, read_us, &fx, &fy);
+				*x = (uint16_t)fx;
+				*y = (uint16_t)fy;
+		} else {
+				touch_filter_reset(&g_filter);
+		}
+		#else
+		(void)read_us;
+		#endif
+
+		#if TOUCH_GESTURES
+		TouchGesture gesture;
+		if (touch_gesture_feed(&g_gestures, now_ms, pressed, fx, fy, second, (int16_t)x2, (int16_t)y2, &gesture)) {
+				dispatchGesture(gesture);
+		}
+		#else
+		(void)now_ms; (void)fx; (void)fy; (void)second; (void)x2; (void)y2;
+		#endif
+}
+
+#if TOUCH_GESTURES
+// Send a recognized gesture to the active screen as g_gesture_event (param:
+// const TouchGesture*). Runs inside lv_timer_handler(), LVGL mutex held.
+void TouchManager::dispatchGesture(const TouchGesture& gesture) {
+		g_gesture_count++;
+		LOGD("Touch", "Gesture %s at (%d,%d) d=(%d,%d) scale=%u%% %lu ms",
+				touch_gesture_name(gesture.type), gesture.x, gesture.y, gesture.dx, gesture.dy,
+				gesture.scale_pct, (unsigned long)gesture.duration_ms);
+
+		lv_obj_t* screen = lv_screen_active();
+		if (screen && g_gesture_event) {
+				lv_obj_send_event(screen, (lv_event_code_t)g_gesture_event, (void*)&gesture);
+		}
+}
+#endif
+
 void TouchManager::init() {
 		LOGI("Touch", "Manager init start");
 		
@@ -106,6 +224,19 @@ void TouchManager::init() {
 		LOGI("Touch", "Rotation: %d", DISPLAY_ROTATION);
 		#endif
 
+		#if TOUCH_FILTER
+		touch_filter_init(&g_filter, &kTouchFilterDefaults);
+		#endif
+		#if TOUCH_GESTURES
+		touch_gesture_init(&g_gestures, &kTouchGestureDefaults);
+		#endif
+
+		#if TOUCH_INT_SAMPLING
+		if (!startSampler()) {
+				LOGI("Touch", "INT sampling unavailable, polling on every LVGL read");
+		}
+		#endif
+
 		// Register with LVGL as input device.
 		// Do NOT block boot indefinitely if the LVGL task/mutex is stuck; defer and retry.
 		lvglRegisterPending = true;
@@ -139,6 +270,9 @@ bool TouchManager::tryRegisterWithLVGL() {
 				lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
 				lv_indev_set_read_cb(indev, TouchManager::readCallback);
 				lv_indev_set_user_data(indev, this);
+				#if TOUCH_GESTURES
+				g_gesture_event = lv_event_register_id();
+				#endif
 		}
 
 		#if HAS_DISPLAY
@@ -149,18 +283,91 @@ bool TouchManager::tryRegisterWithLVGL() {
 		return indev != nullptr;
 }
 
+void IRAM_ATTR TouchManager::onTouchInterrupt() {
+		__atomic_fetch_add(&g_touch_irqs, 1, __ATOMIC_RELAXED);
+		BaseType_t woken = pdFALSE;
+		vTaskNotifyGiveFromISR(g_sampler_task, &woken);
+		portYIELD_FROM_ISR(woken);
+}
+
+void TouchManager::samplerTaskFn(void* pvParameter) {
+		TouchManager* mgr = (TouchManager*)pvParameter;
+		uint32_t prev = 0;
+		uint32_t prev2 = 0;
+
+		while (true) {
+				TouchPoint pts[TOUCH_READ_POINTS] = {};
+				const uint32_t read_us = (uint32_t)esp_timer_get_time();
+				const uint8_t n = mgr->driver->getTouchPoints(pts, TOUCH_READ_POINTS);
+				const bool pressed = n > 0;
+				const uint16_t x = pts[0].x;
+				const uint16_t y = pts[0].y;
+				__atomic_fetch_add(&g_touch_i2c_reads, 1, __ATOMIC_RELAXED);
+
+				// On release keep the last position; LVGL reports it with the RELEASED state.
+				const uint32_t next = pressed ? touch_slot_pack(x, y, true) : (prev & ~TOUCH_SLOT_PRESSED);
+				const uint32_t next2 = n > 1 ? touch_slot_pack(pts[1].x, pts[1].y, true) : 0;
+				const bool changed = next != prev || next2 != prev2;
+				if (pressed && !(prev & TOUCH_SLOT_PRESSED)) {
+						__atomic_store_n(&g_touch_press_us, read_us, __ATOMIC_RELAXED);  // Released by the slot store
+				}
+				__atomic_store_n(&g_touch_slot2, next2, __ATOMIC_RELAXED);
+				__atomic_store_n(&g_touch_slot, next, __ATOMIC_RELEASE);
+				prev2 = next2;
+				if (changed) {
+						#if HAS_DISPLAY
+						display_manager_wake();  // An idle-parked LVGL task reads the new point now
+						#endif
+						prev = next;
+				}
+
+				// Released: sleep until the next edge. Pressed: also re-read periodically,
+				// since a lost release edge would otherwise leave LVGL stuck on PRESSED.
+				ulTaskNotifyTake(pdTRUE, pressed ? pdMS_TO_TICKS(TOUCH_INT_PRESSED_POLL_MS) : portMAX_DELAY);
+		}
+}
+
+bool TouchManager::startSampler() {
+		const int pin = driver->interruptPin();
+		if (pin < 0 || digitalPinToInterrupt(pin) < 0) return false;
+
+		// Same core as init(): the I2C driver's interrupt was allocated here,
+		// and keeping the bus on one core avoids the cross-core contention
+		// described in gt911_touch_driver.h.
+		const BaseType_t core = xPortGetCoreID();
+		if (xTaskCreatePinnedToCore(samplerTaskFn, "TouchINT", 3072, this, LVGL_TASK_PRIORITY + 1, &samplerTask, core) != pdPASS) {
+				samplerTask = nullptr;
+				LOGE("Touch", "Sampler task create failed");
+				return false;
+		}
+		g_sampler_task = samplerTask;
+
+		pinMode(pin, INPUT_PULLUP);
+		// Controllers differ in INT polarity (GT911 is configurable): any edge
+		// just schedules one read.
+		attachInterrupt(digitalPinToInterrupt(pin), onTouchInterrupt, CHANGE);
+		LOGI("Touch", "INT sampling on GPIO%d (core %d)", pin, (int)core);
+		return true;
+}
+
 void TouchManager::loop() {
 		(void)tryRegisterWithLVGL();
 }
 
 bool TouchManager::isTouched() {
+		if (samplerTask) return touch_slot_read(nullptr, nullptr);
 		return driver->isTouched();
 }
 
 bool TouchManager::getTouch(uint16_t* x, uint16_t* y) {
+		if (samplerTask) return touch_slot_read(x, y);
 		return driver->getTouch(x, y);
 }
 
+bool TouchManager::samplerActive() const {
+		return samplerTask != nullptr;
+}
+
 // C-style interface for app.ino
 void touch_manager_init() {
 		if (!touchManager) {
@@ -192,4 +399,30 @@ void touch_manager_set_lvgl_force_released(bool force_released) {
 		g_lvgl_force_released = force_released;
 }
 
+uint32_t touch_manager_gesture_event() {
+		#if TOUCH_GESTURES
+		return g_gesture_event;
+		#else
+		return 0;
+		#endif
+}
+
+uint32_t touch_manager_gesture_count() {
+		#if TOUCH_GESTURES
+		return g_gesture_count;
+		#else
+		return 0;
+		#endif
+}
+
+bool touch_manager_get_sampler_stats(TouchSamplerStats* out) {
+		if (!out || !touchManager) return false;
+		out->active = touchManager->samplerActive();
+		out->interrupts = __atomic_load_n(&g_touch_irqs, __ATOMIC_RELAXED);
+		out->i2c_reads = __atomic_load_n(&g_touch_i2c_reads, __ATOMIC_RELAXED);
+		out->cache_reads = __atomic_load_n(&g_touch_cache_reads, __ATOMIC_RELAXED);
+		out->reads_saved = out->cache_reads > out->i2c_reads ? out->cache_reads - out->i2c_reads : 0;
+		return true;
+}
+
 #endif // HAS_TOUCH
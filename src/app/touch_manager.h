@@ -16,6 +16,8 @@
 #include <lvgl.h>
 #include "touch_driver.h"
 
+struct TouchGesture;
+
 class TouchManager {
 private:
 		TouchDriver* driver;
@@ -26,6 +28,17 @@ private:
 		
 		// LVGL read callback (static, accesses instance via user_data)
 		static void readCallback(lv_indev_t* indev, lv_indev_data_t* data);
+
+		// Filtering + gesture recognition (TOUCH_FILTER / TOUCH_GESTURES)
+		void processSample(uint32_t now_ms, uint32_t read_us, bool pressed, uint16_t* x, uint16_t* y,
+				bool second, uint16_t x2, uint16_t y2);
+		void dispatchGesture(const TouchGesture& gesture);
+
+		// Interrupt-driven sampling (TOUCH_INT_SAMPLING)
+		TaskHandle_t samplerTask;
+		bool startSampler();
+		static void samplerTaskFn(void* pvParameter);
+		static void IRAM_ATTR onTouchInterrupt();
 		
 public:
 		TouchManager();
@@ -40,6 +53,19 @@ public:
 		// Get touch state (for debugging)
 		bool isTouched();
 		bool getTouch(uint16_t* x, uint16_t* y);
+
+		// INT-driven sampler running (reads come from the cached point)
+		bool samplerActive() const;
+};
+
+// Interrupt-driven sampling counters (TOUCH_INT_SAMPLING).
+// Every cache read replaces an I2C transaction the poll path would have made.
+struct TouchSamplerStats {
+		bool active;           // Sampler running (INT pin wired and attached)
+		uint32_t interrupts;   // INT edges seen
+		uint32_t i2c_reads;    // Controller reads done by the sampler
+		uint32_t cache_reads;  // LVGL / isTouched() reads served from the cached point
+		uint32_t reads_saved;  // cache_reads - i2c_reads (0 if negative)
 };
 
 // C-style interface for app.ino
@@ -55,6 +81,16 @@ void touch_manager_suppress_lvgl_input(uint32_t duration_ms);
 // Screen saver uses this while dimming/asleep/fading in.
 void touch_manager_set_lvgl_force_released(bool force_released);
 
+// Returns false when touch is not initialized.
+bool touch_manager_get_sampler_stats(TouchSamplerStats* out);
+
+// LVGL event code sent to the active screen for each recognized gesture
+// (TOUCH_GESTURES); lv_event_get_param() is a const TouchGesture*
+// (touch_gesture.h). 0 until touch is registered with LVGL, or when disabled.
+//   lv_obj_add_event_cb(screen, cb, (lv_event_code_t)touch_manager_gesture_event(), this);
+uint32_t touch_manager_gesture_event();
+uint32_t touch_manager_gesture_count();
+
 #endif // HAS_TOUCH
 
 #endif // TOUCH_MANAGER_H
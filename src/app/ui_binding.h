@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Versioned values for Screen::update() data binding.
+//
+// Producers publish with ui_value_publish() / ui_text_publish(); the version
+// only advances when the value actually changes. Screens keep one UiBinding
+// per bound label and call ui_value_take() / ui_text_take() from update():
+// they return true (with the value) only when the version moved since the
+// previous take, so formatting and lv_label_set_text() (which always
+// invalidates, even for identical text) run once per change instead of once
+// per poll.
+//
+// Concurrency: one producer task per value, any number of reader tasks.
+// - UiValue: value word + version word (release/acquire). A reader racing a
+//   second publish may pair the newer value with the older version; the next
+//   take then reports one redundant change, never a missed one.
+// - UiText: sequence lock (seq is odd while the producer writes). Readers
+//   never spin: a torn or in-progress read returns false and is retried on the
+//   next update(), so a high-priority reader cannot starve a preempted producer.
+//
+// ui_binding_changed() covers values a screen derives itself (e.g. a perf
+// stat or the uptime at the granularity it is displayed).
+
+#define UI_TEXT_MAX 48
+
+struct UiValue {
+		uint32_t value;
+		uint32_t version;  // 0 = never published
+};
+
+struct UiText {
+		char text[UI_TEXT_MAX];
+		uint32_t seq;      // 0 = never published, odd = write in progress
+};
+
+// Per-consumer state: what the bound widget currently shows.
+struct UiBinding {
+		uint32_t seen;
+		bool bound;
+};
+
+// Forget what the widget shows (call when its widgets are (re)created).
+static inline void ui_binding_reset(UiBinding* b) {
+		b->seen = 0;
+		b->bound = false;
+}
+
+// True when key differs from the previous call (or on the first call).
+static inline bool ui_binding_changed(UiBinding* b, uint32_t key) {
+		if (b->bound && b->seen == key) return false;
+		b->seen = key;
+		b->bound = true;
+		return true;
+}
+
+static inline void ui_value_publish(UiValue* v, uint32_t value) {
+		const uint32_t version = __atomic_load_n(&v->version, __ATOMIC_RELAXED);
+		if (version != 0 && __atomic_load_n(&v->value, __ATOMIC_RELAXED) == value) return;
+		__atomic_store_n(&v->value, value, __ATOMIC_RELAXED);
+		__atomic_store_n(&v->version, version + 1, __ATOMIC_RELEASE);
+}
+
+static inline bool ui_value_take(const UiValue* v, UiBinding* b, uint32_t* out) {
+		const uint32_t version = __atomic_load_n(&v->version, __ATOMIC_ACQUIRE);
+		if (version == 0 || !ui_binding_changed(b, version)) return false;
+		*out = __atomic_load_n(&v->value, __ATOMIC_RELAXED);
+		return true;
+}
+
+// Publish text (truncated to UI_TEXT_MAX - 1). No-op when unchanged.
+static inline void ui_text_publish(UiText* t, const char* text) {
+		if (!text) text = "";
+		const uint32_t seq = __atomic_load_n(&t->seq, __ATOMIC_RELAXED);
+		if (seq != 0 && strncmp(t->text, text, UI_TEXT_MAX - 1) == 0) return;
+
+		__atomic_store_n(&t->seq, seq + 1, __ATOMIC_RELAXED);  // odd: writing
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+		strncpy(t->text, text, UI_TEXT_MAX - 1);
+		t->text[UI_TEXT_MAX - 1] = '\0';
+		__atomic_store_n(&t->seq, seq + 2, __ATOMIC_RELEASE);  // even: stable
+}
+
+// Copy the text into out (out_len >= UI_TEXT_MAX recommended) if it changed
+// since the previous take. Returns false when unchanged or mid-write.
+static inline bool ui_text_take(const UiText* t, UiBinding* b, char* out, size_t out_len) {
+		const uint32_t seq = __atomic_load_n(&t->seq, __ATOMIC_ACQUIRE);
+		if (seq == 0 || (seq & 1) || (b->bound && b->seen == seq)) return false;
+
+		const size_t n = out_len < UI_TEXT_MAX ? out_len : UI_TEXT_MAX;
+		memcpy(out, t->text, n);
+		out[n - 1] = '\0';
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&t->seq, __ATOMIC_RELAXED) != seq) return false;
+
+		b->seen = seq;
+		b->bound = true;
+		return true;
+}
@@ -0,0 +1,60 @@
+#include "board_config.h"
+
+#if HAS_DISPLAY
+
+#include "ui_state.h"
+#include "device_telemetry.h"
+#include "display_manager.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+UiState g_ui_state = {};
+
+static uint32_t g_last_sample_ms = 0;
+
+// Sum of all versions/sequences: changes whenever anything was published.
+static uint32_t ui_state_generation() {
+		return g_ui_state.device_name.seq + g_ui_state.mdns_host.seq + g_ui_state.ip.seq
+				+ g_ui_state.heap_free_kb.version + g_ui_state.cpu_pct.version;
+}
+
+void ui_state_loop(const DeviceConfig* config) {
+		const uint32_t now = millis();
+		if (g_last_sample_ms != 0 && (uint32_t)(now - g_last_sample_ms) < UI_STATE_SAMPLE_MS) {
+				return;
+		}
+		g_last_sample_ms = now;
+
+		const uint32_t before = ui_state_generation();
+
+		if (config) {
+				ui_text_publish(&g_ui_state.device_name,
+						strlen(config->device_name) > 0 ? config->device_name : "ESP32 Device");
+
+				char sanitized[CONFIG_DEVICE_NAME_MAX_LEN];
+				config_manager_sanitize_device_name(config->device_name, sanitized, sizeof(sanitized));
+				char mdns_text[CONFIG_DEVICE_NAME_MAX_LEN + 10];
+				snprintf(mdns_text, sizeof(mdns_text), "%s.local", sanitized);
+				ui_text_publish(&g_ui_state.mdns_host, mdns_text);
+		}
+
+		if (WiFi.status() == WL_CONNECTED) {
+				ui_text_publish(&g_ui_state.ip, WiFi.localIP().toString().c_str());
+		} else if (WiFi.getMode() == WIFI_AP) {
+				ui_text_publish(&g_ui_state.ip, WiFi.softAPIP().toString().c_str());
+		} else {
+				ui_text_publish(&g_ui_state.ip, "No IP");
+		}
+
+		ui_value_publish(&g_ui_state.heap_free_kb, (uint32_t)(ESP.getFreeHeap() / 1024));
+		const int cpu_usage = device_telemetry_get_cpu_usage();
+		ui_value_publish(&g_ui_state.cpu_pct, cpu_usage >= 0 ? (uint32_t)cpu_usage : UI_CPU_UNKNOWN);
+
+		// Let an idle-parked LVGL task pick the change up now rather than at its next poll.
+		if (ui_state_generation() != before) {
+				display_manager_wake();
+		}
+}
+
+#endif // HAS_DISPLAY
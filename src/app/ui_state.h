@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ui_binding.h"
+#include "config_manager.h"
+
+// Display-facing device state for screen data binding (see ui_binding.h).
+//
+// ui_state_loop() is the single producer: it samples config, WiFi, heap and
+// CPU from the main loop every UI_STATE_SAMPLE_MS and publishes whatever
+// changed, then wakes the LVGL task. Screens only read g_ui_state.
+
+#define UI_STATE_SAMPLE_MS 500
+
+// cpu_pct value when FreeRTOS runtime stats are unavailable.
+#define UI_CPU_UNKNOWN 0xFFFFFFFFu
+
+struct UiState {
+		UiText device_name;     // Configured name ("ESP32 Device" when empty)
+		UiText mdns_host;       // "<sanitized-name>.local"
+		UiText ip;              // Station IP, soft-AP IP or "No IP"
+		UiValue heap_free_kb;
+		UiValue cpu_pct;        // 0-100 or UI_CPU_UNKNOWN
+};
+
+extern UiState g_ui_state;
+
+// Call from loop(); cheap between samples.
+void ui_state_loop(const DeviceConfig* config);
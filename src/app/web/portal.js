@@ -1264,10 +1264,16 @@ document.addEventListener('DOMContentLoaded', () => {
 
 const API_HEALTH = '/api/health';
 const API_HEALTH_HISTORY = '/api/health/history';
+const API_HEALTH_STREAM = '/api/health/stream';
 
 let healthExpanded = false;
 let healthPollTimer = null;
 
+// Server push (/api/health/stream). While it delivers, polling is stopped.
+let healthStream = null;
+let healthStreamActive = false;
+let healthStreamState = null;
+
 const HEALTH_POLL_INTERVAL_DEFAULT_MS = 5000;
 const HEALTH_HISTORY_DEFAULT_SECONDS = 300;
 let healthPollIntervalMs = HEALTH_POLL_INTERVAL_DEFAULT_MS;
@@ -1277,6 +1283,24 @@ let healthDeviceHistoryAvailable = false;
 let healthDeviceHistoryPeriodMs = HEALTH_POLL_INTERVAL_DEFAULT_MS;
 let healthLastHistoryFetchMs = 0;
 
+// Incremental device history (?format=bin&since=): columns kept across polls.
+const HEALTH_HISTORY_BIN_COLUMNS = [
+    'cpu_usage',
+    'uptime_ms',
+    'heap_internal_free',
+    'heap_internal_free_min_window',
+    'heap_internal_free_max_window',
+    'psram_free',
+    'psram_free_min_window',
+    'psram_free_max_window',
+    'heap_internal_largest',
+    'heap_internal_largest_min_window',
+    'heap_internal_largest_max_window',
+];
+let healthHistoryBinSupported = true;
+let healthHistoryBootId = null;  // boot_id the held columns belong to
+let healthHistoryColumns = null;
+
 const healthHistory = {
     cpu: [],
     cpuTs: [],
@@ -1403,6 +1427,85 @@ function healthReplaceArray(dst, src) {
     }
 }
 
+// Decode the binary history: 20-byte header, then per column `count`
+// zigzag varints (first absolute, rest deltas mod 2^32). Returns null if malformed.
+function healthDecodeHistoryBin(buf) {
+    const bytes = new Uint8Array(buf);
+    if (bytes.length < 20 || bytes[0] !== 0x48 || bytes[1] !== 0x48 || bytes[2] !== 2) return null;
+    const view = new DataView(buf);
+    const columnCount = bytes[3];
+    const out = {
+        period_ms: view.getUint32(4, true),
+        capacity: view.getUint16(8, true),
+        count: view.getUint16(10, true),
+        now_ms: view.getUint32(12, true),
+        boot_id: view.getUint32(16, true),
+        columns: {},
+    };
+    if (columnCount !== HEALTH_HISTORY_BIN_COLUMNS.length) return null;
+
+    let pos = 20;
+    for (let c = 0; c < columnCount; c++) {
+        const values = new Array(out.count);
+        let prev = 0;
+        for (let i = 0; i < out.count; i++) {
+            let zz = 0;
+            let scale = 1;
+            let b;
+            do {
+                if (pos >= bytes.length) return null;
+                b = bytes[pos++];
+                zz += (b & 0x7f) * scale;
+                scale *= 128;
+            } while (b & 0x80);
+            const delta = (zz >>> 1) ^ -(zz & 1);
+            prev = (prev + delta) >>> 0;
+            values[i] = prev;
+        }
+        out.columns[HEALTH_HISTORY_BIN_COLUMNS[c]] = values;
+    }
+    return out;
+}
+
+// Fetch only samples newer than the last one held, and append them.
+// Returns the merged history in the JSON response shape, null on a failure
+// worth retrying next poll, or false when the device has no binary history
+// (400/404 or a payload this page cannot read): fall back to JSON.
+async function healthFetchHistoryIncremental() {
+    const cols = healthHistoryColumns;
+    const uptimes = cols ? cols.uptime_ms : null;
+    const since = (uptimes && uptimes.length > 0) ? uptimes[uptimes.length - 1] : null;
+    const url = since !== null ? `${API_HEALTH_HISTORY}?format=bin&since=${since}` : `${API_HEALTH_HISTORY}?format=bin`;
+
+    const resp = await fetch(url);
+    if (!resp.ok) return (resp.status === 400 || resp.status === 404) ? false : null;
+    const hist = healthDecodeHistoryBin(await resp.arrayBuffer());
+    if (!hist) return false;
+
+    if (cols && hist.boot_id !== healthHistoryBootId) {
+        // Device rebooted: the held columns belong to the previous boot, start over.
+        healthHistoryColumns = null;
+        return healthFetchHistoryIncremental();
+    }
+
+    if (!cols) {
+        healthHistoryColumns = hist.columns;
+        healthHistoryBootId = hist.boot_id;
+    } else {
+        for (const name of HEALTH_HISTORY_BIN_COLUMNS) {
+            const dst = cols[name];
+            const src = hist.columns[name];
+            for (let i = 0; i < src.length; i++) dst.push(src[i]);
+            if (dst.length > hist.capacity) dst.splice(0, dst.length - hist.capacity);
+        }
+    }
+
+    const merged = { available: true, period_ms: hist.period_ms };
+    for (const name of HEALTH_HISTORY_BIN_COLUMNS) merged[name] = healthHistoryColumns[name].slice();
+    merged.cpu_usage = merged.cpu_usage.map((v) => ((v | 0) < 0 ? null : v));
+    return merged;
+}
+
 async function updateHealthHistory({ hasPsram = null } = {}) {
     if (!healthDeviceHistoryAvailable) return;
     if (!healthExpanded) return;
@@ -1413,9 +1516,21 @@ async function updateHealthHistory({ hasPsram = null } = {}) {
     healthLastHistoryFetchMs = now;
 
     try {
-        const resp = await fetch(API_HEALTH_HISTORY);
-        if (!resp.ok) return;
-        const hist = await resp.json();
+        let hist = null;
+        if (healthHistoryBinSupported) {
+            hist = await healthFetchHistoryIncremental();
+            if (hist === null) return;
+            if (hist === false) {
+                healthHistoryBinSupported = false;
+                healthHistoryColumns = null;
+                hist = null;
+            }
+        }
+        if (!hist) {
+            const resp = await fetch(API_HEALTH_HISTORY);
+            if (!resp.ok) return;
+            hist = await resp.json();
+        }
         if (!hist || hist.available !== true) return;
 
         const periodMs = (typeof hist.period_ms === 'number' && isFinite(hist.period_ms) && hist.period_ms > 0) ? Math.trunc(hist.period_ms) : healthDeviceHistoryPeriodMs;
@@ -2163,7 +2278,11 @@ function renderHealth(health) {
             if (health.display_fps === null || health.display_fps === undefined) {
                 displayEl.textContent = 'N/A';
             } else if (typeof health.display_lv_timer_us === 'number' && typeof health.display_present_us === 'number') {
-                displayEl.textContent = `${health.display_fps} fps, ${(health.display_lv_timer_us / 1000).toFixed(1)}ms / ${(health.display_present_us / 1000).toFixed(1)}ms`;
+                let text = `${health.display_fps} fps, ${(health.display_lv_timer_us / 1000).toFixed(1)}ms / ${(health.display_present_us / 1000).toFixed(1)}ms`;
+                if (typeof health.display_bytes_per_frame === 'number') {
+                    text += `, ${(health.display_bytes_per_frame / 1024).toFixed(1)} KB/frame`;
+                }
+                displayEl.textContent = text;
             } else {
                 displayEl.textContent = `${health.display_fps} fps`;
             }
@@ -2203,8 +2322,14 @@ async function updateHealth() {
         const response = await fetch(API_HEALTH);
         if (!response.ok) return;
 
-        const health = await response.json();
+        await applyHealth(await response.json());
+    } catch (error) {
+        console.error('Failed to fetch health stats:', error);
+    }
+}
 
+async function applyHealth(health) {
+    try {
         const cpuUsage = (typeof health.cpu_usage === 'number' && isFinite(health.cpu_usage)) ? Math.floor(health.cpu_usage) : null;
         const hasPsram = (
             (deviceInfoCache && typeof deviceInfoCache.psram_size === 'number' && deviceInfoCache.psram_size > 0) ||
@@ -2244,10 +2369,56 @@ async function updateHealth() {
             await updateHealthHistory({ hasPsram });
         }
     } catch (error) {
-        console.error('Failed to fetch health stats:', error);
+        console.error('Failed to render health stats:', error);
     }
 }
 
+// Subscribe to /api/health/stream: a full "health" frame, then "health_delta"
+// frames with the changed fields. Falls back to polling (onFallback) when the
+// stream is unavailable, refused (subscriber cap) or closes for good.
+function healthStartStream(onFallback) {
+    if (typeof EventSource === 'undefined') return false;
+
+    const es = new EventSource(API_HEALTH_STREAM);
+    healthStream = es;
+
+    es.addEventListener('health', (e) => {
+        try {
+            healthStreamState = JSON.parse(e.data);
+        } catch (err) {
+            return;
+        }
+        if (!healthStreamActive) {
+            healthStreamActive = true;
+            if (healthPollTimer) {
+                clearInterval(healthPollTimer);
+                healthPollTimer = null;
+            }
+        }
+        applyHealth(healthStreamState);
+    });
+
+    es.addEventListener('health_delta', (e) => {
+        if (!healthStreamState) return;
+        try {
+            Object.assign(healthStreamState, JSON.parse(e.data));
+        } catch (err) {
+            return;
+        }
+        applyHealth(healthStreamState);
+    });
+
+    es.onerror = () => {
+        // EventSource retries on its own unless the server refused the stream.
+        if (es.readyState !== EventSource.CLOSED) return;
+        healthStream = null;
+        healthStreamActive = false;
+        healthStreamState = null;
+        onFallback();
+    };
+    return true;
+}
+
 function toggleHealthWidget() {
     healthExpanded = !healthExpanded;
     const expandedEl = document.getElementById('health-expanded');
@@ -2292,12 +2463,14 @@ function initHealthWidget() {
         }
         healthConfigureFromDeviceInfo(deviceInfoCache);
         healthConfigureHistoryFromDeviceInfo(deviceInfoCache);
+        if (healthStreamActive) return;
         healthPollTimer = setInterval(updateHealth, healthPollIntervalMs);
     };
 
     // Initial
     updateHealth();
     startPolling();
+    healthStartStream(startPolling);
 
     // Re-tune polling once deviceInfoCache becomes available.
     setTimeout(startPolling, 1500);
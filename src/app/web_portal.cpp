@@ -27,6 +27,7 @@
 #include "portal_idle.h"
 #include "web_portal_firmware.h"
 #include "web_portal_ap.h"
+#include "web_portal_health_stream.h"
 
 #if HAS_DISPLAY
 #include "display_manager.h"
@@ -130,6 +131,8 @@ void web_portal_handle() {
 
 		web_portal_config_loop();
 
+		web_portal_health_stream_loop();
+
 		portal_idle_loop();
 }
 
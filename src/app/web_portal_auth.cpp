@@ -5,6 +5,46 @@
 #include "config_manager.h"
 #include "project_branding.h"
 
+#include <esp_timer.h>
+
+// Verified "Basic ..." headers. A hit skips request->authenticate(), which
+// base64-encodes user:pass into a String and compares on every call.
+// Entries are found by a 64-bit hash of the raw header, and a hit still
+// compares the stored header bytes in constant time, so the hash only picks
+// the slot. Headers longer than PORTAL_AUTH_CACHE_HEADER_MAX are never cached.
+// The cache is tagged with a hash of the configured credentials, so any change
+// to basic_auth_* (POST /api/config, reset, reload) drops it on the next check.
+// Only touched from the AsyncTCP task.
+#define PORTAL_AUTH_CACHE_SLOTS 4
+#define PORTAL_AUTH_CACHE_HEADER_MAX 128
+
+// Request attribute marking a request that already passed the gate.
+#define PORTAL_AUTH_ATTR "portal_auth"
+
+struct PortalAuthCacheEntry {
+		uint64_t header_hash;  // 0 = free slot
+		uint32_t last_used;
+		char header[PORTAL_AUTH_CACHE_HEADER_MAX];  // Verified header, zero padded
+};
+
+static PortalAuthCacheEntry g_cache[PORTAL_AUTH_CACHE_SLOTS] = {};
+static uint64_t g_cache_credentials = 0;
+static uint32_t g_cache_clock = 0;
+
+// Written on the AsyncTCP task, read by /api/health/stream from loop().
+static PortalAuthStats g_stats = {};
+static portMUX_TYPE g_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint64_t fnv1a64(uint64_t h, const char *s) {
+		while (*s) {
+				h ^= (uint8_t)*s++;
+				h *= 0x100000001b3ULL;
+		}
+		return h;
+}
+
+static const uint64_t kFnvOffset = 0xcbf29ce484222325ULL;
+
 static bool portal_auth_required() {
 		if (web_portal_is_ap_mode_active()) return false;
 
@@ -14,6 +54,85 @@ static bool portal_auth_required() {
 		return config->basic_auth_enabled;
 }
 
+// Hash of the configured credentials; the cache is only valid for the value it was filled under.
+static uint64_t credentials_hash(const DeviceConfig *config) {
+		uint64_t h = fnv1a64(kFnvOffset, config->basic_auth_username);
+		h = fnv1a64(h ^ ':', config->basic_auth_password);
+		return h ? h : 1;
+}
+
+// Compares all PORTAL_AUTH_CACHE_HEADER_MAX bytes whatever the contents.
+static bool header_equal_ct(const char *a, const char *b) {
+		uint8_t diff = 0;
+		for (size_t i = 0; i < PORTAL_AUTH_CACHE_HEADER_MAX; i++) {
+				diff |= (uint8_t)(a[i] ^ b[i]);
+		}
+		return diff == 0;
+}
+
+// header: zero padded to PORTAL_AUTH_CACHE_HEADER_MAX.
+static bool cache_lookup(uint64_t header_hash, const char *header) {
+		for (PortalAuthCacheEntry &e : g_cache) {
+				if (e.header_hash == header_hash && header_equal_ct(e.header, header)) {
+						e.last_used = ++g_cache_clock;
+						return true;
+				}
+		}
+		return false;
+}
+
+static void cache_insert(uint64_t header_hash, const char *header) {
+		PortalAuthCacheEntry *slot = &g_cache[0];
+		for (PortalAuthCacheEntry &e : g_cache) {
+				if (!e.header_hash) {
+						slot = &e;
+						break;
+				}
+				if ((int32_t)(e.last_used - slot->last_used) < 0) slot = &e;
+		}
+		slot->header_hash = header_hash;
+		slot->last_used = ++g_cache_clock;
+		memcpy(slot->header, header, PORTAL_AUTH_CACHE_HEADER_MAX);
+}
+
+// *memo / *cache_hit / *verified report which path decided, for the stats.
+static bool portal_auth_check(AsyncWebServerRequest *request, const DeviceConfig *config,
+		bool *memo, bool *cache_hit, bool *verified) {
+		if (request->getAttribute(PORTAL_AUTH_ATTR, false)) {
+				*memo = true;
+				return true;
+		}
+
+		const uint64_t credentials = credentials_hash(config);
+		if (credentials != g_cache_credentials) {
+				memset(g_cache, 0, sizeof(g_cache));
+				g_cache_credentials = credentials;
+		}
+
+		const AsyncWebHeader *header = request->getHeader("Authorization");
+		uint64_t header_hash = 0;
+		char padded[PORTAL_AUTH_CACHE_HEADER_MAX] = {};
+		if (header && header->value().startsWith("Basic ") && header->value().length() < PORTAL_AUTH_CACHE_HEADER_MAX) {
+				memcpy(padded, header->value().c_str(), header->value().length());
+				header_hash = fnv1a64(kFnvOffset, padded);
+				if (!header_hash) header_hash = 1;
+				if (cache_lookup(header_hash, padded)) {
+						*cache_hit = true;
+						request->setAttribute(PORTAL_AUTH_ATTR, true);
+						return true;
+				}
+		}
+
+		*verified = true;
+		if (!request->authenticate(config->basic_auth_username, config->basic_auth_password)) {
+				return false;
+		}
+
+		if (header_hash) cache_insert(header_hash, padded);
+		request->setAttribute(PORTAL_AUTH_ATTR, true);
+		return true;
+}
+
 bool portal_auth_gate(AsyncWebServerRequest *request) {
 		portal_idle_notify_activity();
 
@@ -22,13 +141,46 @@ bool portal_auth_gate(AsyncWebServerRequest *request) {
 		DeviceConfig *config = web_portal_get_current_config();
 		if (!config) return true;
 
-		const char *user = config->basic_auth_username;
-		const char *pass = config->basic_auth_password;
+		bool memo = false, cacheHit = false, verified = false;
+		const int64_t t0 = esp_timer_get_time();
+		const bool ok = portal_auth_check(request, config, &memo, &cacheHit, &verified);
+		const uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+
+		portENTER_CRITICAL(&g_stats_mux);
+		g_stats.checks++;
+		g_stats.memo_hits += memo;
+		g_stats.cache_hits += cacheHit;
+		g_stats.verifies += verified;
+		g_stats.failures += !ok;
+		g_stats.total_us += us;
+		if (us > g_stats.max_us) g_stats.max_us = us;
+		portEXIT_CRITICAL(&g_stats_mux);
 
-		if (request->authenticate(user, pass)) {
+		if (ok) {
 				return true;
 		}
 
 		request->requestAuthentication(PROJECT_DISPLAY_NAME);
 		return false;
 }
+
+void portal_auth_get_stats(PortalAuthStats *out) {
+		if (!out) return;
+		portENTER_CRITICAL(&g_stats_mux);
+		*out = g_stats;
+		portEXIT_CRITICAL(&g_stats_mux);
+		out->avg_us = out->checks ? (uint32_t)(out->total_us / out->checks) : 0;
+}
+
+void portal_auth_fill_json(JsonDocument &doc) {
+		PortalAuthStats auth;
+		portal_auth_get_stats(&auth);
+		doc["portal_auth_checks"] = auth.checks;
+		doc["portal_auth_memo_hits"] = auth.memo_hits;
+		doc["portal_auth_cache_hits"] = auth.cache_hits;
+		doc["portal_auth_verifies"] = auth.verifies;
+		doc["portal_auth_failures"] = auth.failures;
+		doc["portal_auth_us_total"] = auth.total_us;
+		doc["portal_auth_avg_us"] = auth.avg_us;
+		doc["portal_auth_max_us"] = auth.max_us;
+}
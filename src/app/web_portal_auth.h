@@ -1,10 +1,30 @@
 #ifndef WEB_PORTAL_AUTH_H
 #define WEB_PORTAL_AUTH_H
 
+#include <ArduinoJson.h>
 #include <ESPAsyncWebServer.h>
 
 // Basic auth gate (optional; STA/full mode only).
 // Returns true if request is authorized (or auth disabled); otherwise sends auth challenge and returns false.
+// A verified Authorization header is cached (see web_portal_auth.cpp), and a request that
+// passed once (e.g. OTA upload chunks) is not checked again.
 bool portal_auth_gate(AsyncWebServerRequest *request);
 
+// Gate cost since boot, counting only requests where auth was required.
+struct PortalAuthStats {
+		uint32_t checks;       // Gate calls
+		uint32_t memo_hits;    // Request already passed (multi-chunk bodies)
+		uint32_t cache_hits;   // Header matched a verified entry
+		uint32_t verifies;     // Full request->authenticate() calls
+		uint32_t failures;     // Challenges sent
+		uint64_t total_us;
+		uint32_t avg_us;
+		uint32_t max_us;
+};
+
+void portal_auth_get_stats(PortalAuthStats *out);
+
+// Add the portal_auth_* fields to a health document (/api/health and /api/health/stream).
+void portal_auth_fill_json(JsonDocument &doc);
+
 #endif // WEB_PORTAL_AUTH_H
@@ -179,6 +179,10 @@ void handleGetHealth(AsyncWebServerRequest *request) {
 		std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>> doc = make_psram_json_doc(2048);
 		if (doc && doc->capacity() > 0) {
 				device_telemetry_fill_api(*doc);
+
+				// Auth gate cost (portal-side, so not part of the shared telemetry)
+				portal_auth_fill_json(*doc);
+
 				if (doc->overflowed()) {
 						LOGE("Portal", "/api/health JSON overflow");
 				}
@@ -187,7 +191,91 @@ void handleGetHealth(AsyncWebServerRequest *request) {
 		web_portal_send_json_chunked(request, doc);
 }
 
+#if HEALTH_HISTORY_ENABLED
+// History columns, in response order (JSON fields and binary columns).
+// cpu_usage is sign-extended so -1 (unknown) round-trips through the u32 encoding.
+struct HealthHistoryColumn {
+		const char *name;
+		uint32_t (*get)(const HealthHistorySample &s);
+};
+
+static const HealthHistoryColumn kHealthHistoryColumns[] = {
+		{"cpu_usage", [](const HealthHistorySample &s) { return (uint32_t)(int32_t)s.cpu_usage; }},
+		{"uptime_ms", [](const HealthHistorySample &s) { return s.uptime_ms; }},
+		{"heap_internal_free", [](const HealthHistorySample &s) { return s.heap_internal_free; }},
+		{"heap_internal_free_min_window", [](const HealthHistorySample &s) { return s.heap_internal_free_min_window; }},
+		{"heap_internal_free_max_window", [](const HealthHistorySample &s) { return s.heap_internal_free_max_window; }},
+		{"psram_free", [](const HealthHistorySample &s) { return s.psram_free; }},
+		{"psram_free_min_window", [](const HealthHistorySample &s) { return s.psram_free_min_window; }},
+		{"psram_free_max_window", [](const HealthHistorySample &s) { return s.psram_free_max_window; }},
+		{"heap_internal_largest", [](const HealthHistorySample &s) { return s.heap_internal_largest; }},
+		{"heap_internal_largest_min_window", [](const HealthHistorySample &s) { return s.heap_internal_largest_min_window; }},
+		{"heap_internal_largest_max_window", [](const HealthHistorySample &s) { return s.heap_internal_largest_max_window; }},
+};
+static const size_t kHealthHistoryColumnCount = sizeof(kHealthHistoryColumns) / sizeof(kHealthHistoryColumns[0]);
+
+static inline void history_put_le(uint8_t *p, uint32_t v, size_t bytes) {
+		for (size_t i = 0; i < bytes; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+// Binary history (?format=bin), little-endian:
+//   0  'H' 'H'     magic
+//   2  version     2
+//   3  columns     kHealthHistoryColumnCount
+//   4  period_ms   u32
+//   8  capacity    u16
+//   10 count       u16 (samples in this response)
+//   12 now_ms      u32 (device millis())
+//   16 boot_id     u32 (random per boot; a change means the client's columns are stale)
+//   20 columns     per column: count zigzag LEB128 varints, the first value
+//                  absolute and the rest deltas from the previous (mod 2^32)
+static void send_health_history_bin(
+		AsyncWebServerRequest *request,
+		const HealthHistoryParams &params,
+		size_t capacity,
+		const HealthHistorySample *samples,
+		size_t count
+) {
+		AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+		response->addHeader("Cache-Control", "no-store");
+
+		uint8_t header[20] = {'H', 'H', 2, (uint8_t)kHealthHistoryColumnCount};
+		history_put_le(header + 4, params.period_ms, 4);
+		history_put_le(header + 8, (uint32_t)capacity, 2);
+		history_put_le(header + 10, (uint32_t)count, 2);
+		history_put_le(header + 12, (uint32_t)millis(), 4);
+		history_put_le(header + 16, params.boot_id, 4);
+		response->write(header, sizeof(header));
+
+		uint8_t out[64];
+		size_t len = 0;
+		for (size_t c = 0; c < kHealthHistoryColumnCount; c++) {
+				uint32_t prev = 0;
+				for (size_t i = 0; i < count; i++) {
+						const uint32_t v = kHealthHistoryColumns[c].get(samples[i]);
+						const int32_t delta = (int32_t)(v - prev);
+						uint32_t zz = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+						prev = v;
+						do {
+								const uint8_t b = zz & 0x7F;
+								zz >>= 7;
+								out[len++] = zz ? (b | 0x80) : b;
+						} while (zz);
+						if (len > sizeof(out) - 5) {
+								response->write(out, len);
+								len = 0;
+						}
+				}
+		}
+		if (len) response->write(out, len);
+
+		request->send(response);
+}
+#endif // HEALTH_HISTORY_ENABLED
+
 // GET /api/health/history - Get device-side health history for sparklines
+// ?since=<uptime_ms>: only samples taken after that uptime.
+// ?format=bin: delta/varint-encoded columns (see send_health_history_bin()).
 void handleGetHealthHistory(AsyncWebServerRequest *request) {
 		if (!portal_auth_gate(request)) return;
 
@@ -201,9 +289,28 @@ void handleGetHealthHistory(AsyncWebServerRequest *request) {
 		}
 
 		const HealthHistoryParams params = health_history_params();
-		const size_t count = health_history_count();
 		const size_t capacity = health_history_capacity();
 
+		uint32_t since_ms = 0;
+		if (request->hasParam("since")) {
+				since_ms = (uint32_t)strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+		}
+		const bool binary = request->hasParam("format") && request->getParam("format")->value() == "bin";
+
+		// One copy of the ring under a single lock, instead of one lock per field per sample.
+		HealthHistorySample *samples = (HealthHistorySample *)PsramJsonAllocator().allocate(capacity * sizeof(HealthHistorySample));
+		if (!samples) {
+				web_portal_send_json_error(request, 503, "Out of memory");
+				return;
+		}
+		const size_t count = health_history_snapshot(samples, capacity, since_ms);
+
+		if (binary) {
+				send_health_history_bin(request, params, capacity, samples, count);
+				PsramJsonAllocator().deallocate(samples);
+				return;
+		}
+
 		AsyncResponseStream *response = request->beginResponseStream("application/json");
 		response->addHeader("Cache-Control", "no-store");
 
@@ -218,59 +325,32 @@ void handleGetHealthHistory(AsyncWebServerRequest *request) {
 		response->print((unsigned long)count);
 		response->print(",\"capacity\":");
 		response->print((unsigned long)capacity);
-
-		// Helper macro to print a uint32 array field with minimal overhead.
-#define PRINT_U32_ARRAY_FIELD(field_name, expr_u32) \
-		do { \
-				response->print(",\""); \
-				response->print(field_name); \
-				response->print("\":["); \
-				for (size_t i = 0; i < count; i++) { \
-						if (i > 0) response->print(","); \
-						HealthHistorySample s = {}; \
-						if (health_history_get_sample(i, &s)) { \
-								response->print((unsigned long)(expr_u32)); \
-						} else { \
-								response->print("0"); \
-						} \
-				} \
-				response->print("]"); \
-		} while (0)
-
-		// cpu_usage is int16 and may be -1 (unknown).
-		response->print(",\"cpu_usage\":[");
-		for (size_t i = 0; i < count; i++) {
-				if (i > 0) response->print(",");
-				HealthHistorySample s = {};
-				if (health_history_get_sample(i, &s)) {
-						if (s.cpu_usage < 0) {
-								response->print("null");
+		response->print(",\"boot_id\":");
+		response->print((unsigned long)params.boot_id);
+
+		for (size_t c = 0; c < kHealthHistoryColumnCount; c++) {
+				const bool is_cpu = (c == 0);
+				response->print(",\"");
+				response->print(kHealthHistoryColumns[c].name);
+				response->print("\":[");
+				for (size_t i = 0; i < count; i++) {
+						if (i > 0) response->print(",");
+						if (is_cpu) {
+								// cpu_usage is int16 and may be -1 (unknown).
+								if (samples[i].cpu_usage < 0) {
+										response->print("null");
+								} else {
+										response->print((int)samples[i].cpu_usage);
+								}
 						} else {
-								response->print((int)s.cpu_usage);
+								response->print((unsigned long)kHealthHistoryColumns[c].get(samples[i]));
 						}
-				} else {
-						response->print("null");
 				}
+				response->print("]");
 		}
-		response->print("]");
-
-		PRINT_U32_ARRAY_FIELD("uptime_ms", s.uptime_ms);
-
-		PRINT_U32_ARRAY_FIELD("heap_internal_free", s.heap_internal_free);
-		PRINT_U32_ARRAY_FIELD("heap_internal_free_min_window", s.heap_internal_free_min_window);
-		PRINT_U32_ARRAY_FIELD("heap_internal_free_max_window", s.heap_internal_free_max_window);
-
-		PRINT_U32_ARRAY_FIELD("psram_free", s.psram_free);
-		PRINT_U32_ARRAY_FIELD("psram_free_min_window", s.psram_free_min_window);
-		PRINT_U32_ARRAY_FIELD("psram_free_max_window", s.psram_free_max_window);
-
-		PRINT_U32_ARRAY_FIELD("heap_internal_largest", s.heap_internal_largest);
-		PRINT_U32_ARRAY_FIELD("heap_internal_largest_min_window", s.heap_internal_largest_min_window);
-		PRINT_U32_ARRAY_FIELD("heap_internal_largest_max_window", s.heap_internal_largest_max_window);
-
-#undef PRINT_U32_ARRAY_FIELD
 
 		response->print("}");
+		PsramJsonAllocator().deallocate(samples);
 		request->send(response);
 
 		#endif // HEALTH_HISTORY_ENABLED
@@ -0,0 +1,191 @@
+#include "web_portal_health_stream.h"
+
+#include "board_config.h"
+
+#if HEALTH_STREAM_ENABLED
+
+#include "device_telemetry.h"
+#include "log_manager.h"
+#include "portal_idle.h"
+#include "psram_json_allocator.h"
+#include "web_portal_auth.h"
+#include "web_portal_json.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+struct HealthStreamClient {
+		AsyncEventSourceClient *client;  // nullptr = free slot
+		bool synced;                     // Holds the last tick's document; deltas apply
+		uint32_t dropped;                // Ticks skipped for backpressure
+};
+
+static AsyncEventSource *g_stream = nullptr;
+static SemaphoreHandle_t g_stream_mutex = nullptr;  // Guards g_clients (AsyncTCP task vs loop)
+static HealthStreamClient g_clients[HEALTH_STREAM_MAX_CLIENTS] = {};
+static uint32_t g_client_count = 0;
+static bool g_kick = false;  // A client joined: send its full frame without waiting for the tick
+static uint32_t g_last_tick_ms = 0;
+
+// Last tick's document, the baseline for the next delta. Loop task only;
+// released when nobody is subscribed.
+static std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>> g_last_doc;
+
+static char *stream_serialize(const JsonDocument &doc) {
+		const size_t len = measureJson(doc);
+		char *text = (char *)PsramJsonAllocator().allocate(len + 1);
+		if (text) serializeJson(doc, text, len + 1);
+		return text;
+}
+
+// Top-level fields of cur that differ from prev, plus fields prev had and cur lost (as null).
+// Nested values (e.g. "sensors") are compared and sent whole.
+static void stream_build_delta(JsonDocument &delta, JsonObjectConst prev, JsonObjectConst cur) {
+		for (JsonPairConst kv : cur) {
+				if (prev[kv.key()] != kv.value()) {
+						delta[kv.key()] = kv.value();
+				}
+		}
+		for (JsonPairConst kv : prev) {
+				if (!cur.containsKey(kv.key())) {
+						delta[kv.key()] = nullptr;
+				}
+		}
+}
+
+void web_portal_health_stream_register(AsyncWebServer *server) {
+		if (g_stream || !server) return;
+
+		g_stream_mutex = xSemaphoreCreateMutex();
+		if (!g_stream_mutex) {
+				LOGE("Portal", "Health stream mutex alloc failed");
+				return;
+		}
+
+		g_stream = new AsyncEventSource("/api/health/stream");
+
+		g_stream->addMiddleware([](AsyncWebServerRequest *request, ArMiddlewareNext next) {
+				if (!portal_auth_gate(request)) return;
+				if (g_stream->count() >= HEALTH_STREAM_MAX_CLIENTS) {
+						web_portal_send_json_error(request, 503, "Too many health stream subscribers");
+						return;
+				}
+				next();
+		});
+
+		g_stream->onConnect([](AsyncEventSourceClient *client) {
+				xSemaphoreTake(g_stream_mutex, portMAX_DELAY);
+				HealthStreamClient *slot = nullptr;
+				for (HealthStreamClient &c : g_clients) {
+						if (!c.client) {
+								slot = &c;
+								break;
+						}
+				}
+				if (slot) {
+						*slot = {client, false, 0};
+						g_client_count++;
+				}
+				const uint32_t count = g_client_count;
+				xSemaphoreGive(g_stream_mutex);
+
+				if (!slot) {
+						client->close();
+						return;
+				}
+				__atomic_store_n(&g_kick, true, __ATOMIC_RELEASE);
+				LOGI("Portal", "Health stream client joined (%lu/%u)", (unsigned long)count, (unsigned)HEALTH_STREAM_MAX_CLIENTS);
+		});
+
+		g_stream->onDisconnect([](AsyncEventSourceClient *client) {
+				xSemaphoreTake(g_stream_mutex, portMAX_DELAY);
+				for (HealthStreamClient &c : g_clients) {
+						if (c.client == client) {
+								LOGI("Portal", "Health stream client left (%lu ticks dropped)", (unsigned long)c.dropped);
+								c = {};
+								g_client_count--;
+								break;
+						}
+				}
+				xSemaphoreGive(g_stream_mutex);
+		});
+
+		server->addHandler(g_stream);
+}
+
+void web_portal_health_stream_loop() {
+		if (!g_stream) return;
+
+		const uint32_t now_ms = millis();
+		const bool due = (uint32_t)(now_ms - g_last_tick_ms) >= (uint32_t)HEALTH_STREAM_INTERVAL_MS;
+		if (!due && !__atomic_load_n(&g_kick, __ATOMIC_ACQUIRE)) return;
+		__atomic_store_n(&g_kick, false, __ATOMIC_RELEASE);
+
+		if (__atomic_load_n(&g_client_count, __ATOMIC_ACQUIRE) == 0) {
+				g_last_doc.reset();
+				g_last_tick_ms = now_ms;
+				return;
+		}
+
+		// Subscribers count as portal use, as their polls used to.
+		portal_idle_notify_activity();
+
+		// Build outside the client lock so connects/disconnects on the AsyncTCP
+		// task never wait for telemetry.
+		char *delta_text = nullptr;
+		const bool rebuild = due || !g_last_doc;
+		if (rebuild) {
+				std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>> doc = make_psram_json_doc(2048);
+				if (!doc || doc->capacity() == 0) return;
+				device_telemetry_fill_api(*doc);
+				portal_auth_fill_json(*doc);  // Same portal-side fields as /api/health
+
+				if (g_last_doc) {
+						std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>> delta = make_psram_json_doc(1024);
+						if (delta && delta->capacity() > 0) {
+								stream_build_delta(*delta, g_last_doc->as<JsonObjectConst>(), doc->as<JsonObjectConst>());
+								if (!delta->overflowed()) delta_text = stream_serialize(*delta);
+						}
+				}
+				g_last_doc = doc;
+				g_last_tick_ms = now_ms;
+		}
+
+		// Full frame: serialized on first use, shared by every client that needs it.
+		char *full_text = nullptr;
+
+		xSemaphoreTake(g_stream_mutex, portMAX_DELAY);
+		for (HealthStreamClient &c : g_clients) {
+				if (!c.client) continue;
+
+				if (c.client->packetsWaiting() > HEALTH_STREAM_MAX_QUEUED) {
+						// Slow client: drop this tick rather than queue it, resync later.
+						if (rebuild) {
+								c.synced = false;
+								c.dropped++;
+						}
+						continue;
+				}
+
+				if (c.synced) {
+						if (!rebuild) continue;  // Already holds the current document
+						if (delta_text && c.client->send(delta_text, "health_delta")) continue;
+						c.synced = false;
+				}
+
+				if (!full_text) full_text = stream_serialize(*g_last_doc);
+				c.synced = full_text && c.client->send(full_text, "health");
+		}
+		xSemaphoreGive(g_stream_mutex);
+
+		PsramJsonAllocator().deallocate(delta_text);
+		PsramJsonAllocator().deallocate(full_text);
+}
+
+#else
+
+void web_portal_health_stream_register(AsyncWebServer *) {}
+
+void web_portal_health_stream_loop() {}
+
+#endif // HEALTH_STREAM_ENABLED
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <ESPAsyncWebServer.h>
+
+// GET /api/health/stream - Server-Sent Events push of /api/health.
+//
+// Each tick (HEALTH_STREAM_INTERVAL_MS) builds the telemetry document once
+// and serializes at most two frames for all subscribers:
+//   event "health"        full document (new or resyncing clients)
+//   event "health_delta"  top-level fields that changed since the last tick
+//                         (removed fields are sent as null)
+// A client with more than HEALTH_STREAM_MAX_QUEUED frames still unsent skips
+// the tick and gets a full frame once it has drained.
+
+// Register the handler. Must run before the "/api/health" route, which would
+// otherwise match this path as a prefix.
+void web_portal_health_stream_register(AsyncWebServer *server);
+
+// Push a tick when due (call from the main loop).
+void web_portal_health_stream_loop();
@@ -6,6 +6,7 @@
 #include <ChunkPrint.h>
 #include <ESPAsyncWebServer.h>
 
+#include <esp_heap_caps.h>
 #include <memory>
 
 static inline void web_portal_send_json_error(AsyncWebServerRequest *request, int status_code, const char *message) {
@@ -43,17 +44,40 @@ static inline void web_portal_send_json_chunked(
 		}
 
 		const size_t total_len = measureJson(*doc);
-		AsyncWebServerResponse *response = request->beginChunkedResponse(
-				"application/json",
-				[doc, total_len](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
-						if (index >= total_len) return 0;
-						const size_t remaining = total_len - index;
-						const size_t to_write = remaining < max_len ? remaining : max_len;
-						ChunkPrint cp(buffer, index, to_write);
-						(void)serializeJson(*doc, cp);
-						return to_write;
-				}
-		);
+
+		// Serialize once into a PSRAM-preferred buffer and stream slices of it.
+		// The chunk callback runs once per TCP window; re-serializing the whole
+		// document there (ChunkPrint) costs one full pass per chunk. The
+		// document itself is released as soon as this function returns.
+		char *text = (char *)PsramJsonAllocator().allocate(total_len + 1);
+		AsyncWebServerResponse *response = nullptr;
+		if (text) {
+				serializeJson(*doc, text, total_len + 1);
+				std::shared_ptr<char> body(text, heap_caps_free);
+				response = request->beginChunkedResponse(
+						"application/json",
+						[body, total_len](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
+								if (index >= total_len) return 0;
+								const size_t remaining = total_len - index;
+								const size_t to_write = remaining < max_len ? remaining : max_len;
+								memcpy(buffer, body.get() + index, to_write);
+								return to_write;
+						}
+				);
+		} else {
+				// No room for the text: fall back to re-serializing per chunk.
+				response = request->beginChunkedResponse(
+						"application/json",
+						[doc, total_len](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
+								if (index >= total_len) return 0;
+								const size_t remaining = total_len - index;
+								const size_t to_write = remaining < max_len ? remaining : max_len;
+								ChunkPrint cp(buffer, index, to_write);
+								(void)serializeJson(*doc, cp);
+								return to_write;
+						}
+				);
+		}
 
 		if (status_code != 200) {
 				response->setCode(status_code);
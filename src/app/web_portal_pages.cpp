@@ -5,30 +5,62 @@
 
 #include "web_assets.h"
 
+// HTML is revalidated on every visit (cheap 304 when unchanged). CSS/JS linked
+// from the pages carry ?v=<content hash>, so a given URL never changes content.
+#define PAGE_CACHE_CONTROL "private, no-cache"
+#define VERSIONED_ASSET_CACHE_CONTROL "public, max-age=31536000, immutable"
+#define UNVERSIONED_ASSET_CACHE_CONTROL "public, no-cache"
+
+// True when an If-None-Match list ("*", or quoted tags, optionally W/) names etag.
+static bool etag_matches(const String &if_none_match, const char *etag) {
+		if (if_none_match.length() == 0) return false;
+		if (if_none_match == "*") return true;
+		return strstr(if_none_match.c_str(), etag) != nullptr;
+}
+
 static AsyncWebServerResponse *begin_gzipped_asset_response(
 		AsyncWebServerRequest *request,
 		const char *content_type,
 		const uint8_t *content_gz,
 		size_t content_gz_len,
+		const char *etag,
 		const char *cache_control
 ) {
-		// Prefer the PROGMEM-aware response helper to avoid accidental heap copies.
-		// All generated assets live in flash as `const uint8_t[] PROGMEM`.
-		AsyncWebServerResponse *response = request->beginResponse_P(
-				200,
-				content_type,
-				content_gz,
-				content_gz_len
-		);
+		AsyncWebServerResponse *response = nullptr;
+		if (etag && request->hasHeader("If-None-Match")
+				&& etag_matches(request->getHeader("If-None-Match")->value(), etag)) {
+				// Browser copy is current: headers only, nothing read from flash.
+				response = request->beginResponse(304);
+		} else {
+				// Prefer the PROGMEM-aware response helper to avoid accidental heap copies.
+				// All generated assets live in flash as `const uint8_t[] PROGMEM`.
+				response = request->beginResponse_P(
+						200,
+						content_type,
+						content_gz,
+						content_gz_len
+				);
+				response->addHeader("Content-Encoding", "gzip");
+		}
 
-		response->addHeader("Content-Encoding", "gzip");
 		response->addHeader("Vary", "Accept-Encoding");
+		if (etag) {
+				response->addHeader("ETag", etag);
+		}
 		if (cache_control && strlen(cache_control) > 0) {
 				response->addHeader("Cache-Control", cache_control);
 		}
 		return response;
 }
 
+// ?v= matches the current content hash (the etag without its quotes).
+static bool is_current_version(AsyncWebServerRequest *request, const char *etag) {
+		if (!request->hasParam("v")) return false;
+		const String &v = request->getParam("v")->value();
+		const size_t hash_len = strlen(etag) - 2;
+		return v.length() == hash_len && strncmp(v.c_str(), etag + 1, hash_len) == 0;
+}
+
 void handleRoot(AsyncWebServerRequest *request) {
 		if (!portal_auth_gate(request)) return;
 
@@ -44,7 +76,8 @@ void handleRoot(AsyncWebServerRequest *request) {
 				"text/html",
 				home_html_gz,
 				home_html_gz_len,
-				"no-store"
+				home_html_etag,
+				PAGE_CACHE_CONTROL
 		);
 		request->send(response);
 }
@@ -63,7 +96,8 @@ void handleHome(AsyncWebServerRequest *request) {
 				"text/html",
 				home_html_gz,
 				home_html_gz_len,
-				"no-store"
+				home_html_etag,
+				PAGE_CACHE_CONTROL
 		);
 		request->send(response);
 }
@@ -76,7 +110,8 @@ void handleNetwork(AsyncWebServerRequest *request) {
 				"text/html",
 				network_html_gz,
 				network_html_gz_len,
-				"no-store"
+				network_html_etag,
+				PAGE_CACHE_CONTROL
 		);
 		request->send(response);
 }
@@ -95,7 +130,8 @@ void handleFirmware(AsyncWebServerRequest *request) {
 				"text/html",
 				firmware_html_gz,
 				firmware_html_gz_len,
-				"no-store"
+				firmware_html_etag,
+				PAGE_CACHE_CONTROL
 		);
 		request->send(response);
 }
@@ -106,7 +142,8 @@ void handleCSS(AsyncWebServerRequest *request) {
 				"text/css",
 				portal_css_gz,
 				portal_css_gz_len,
-				"public, max-age=600"
+				portal_css_etag,
+				is_current_version(request, portal_css_etag) ? VERSIONED_ASSET_CACHE_CONTROL : UNVERSIONED_ASSET_CACHE_CONTROL
 		);
 		request->send(response);
 }
@@ -117,7 +154,8 @@ void handleJS(AsyncWebServerRequest *request) {
 				"application/javascript",
 				portal_js_gz,
 				portal_js_gz_len,
-				"public, max-age=600"
+				portal_js_etag,
+				is_current_version(request, portal_js_etag) ? VERSIONED_ASSET_CACHE_CONTROL : UNVERSIONED_ASSET_CACHE_CONTROL
 		);
 		request->send(response);
 }
@@ -5,6 +5,7 @@
 #include "web_portal_device_api.h"
 #include "web_portal_display.h"
 #include "web_portal_firmware.h"
+#include "web_portal_health_stream.h"
 #include "web_portal_ota.h"
 #include "web_portal_pages.h"
 
@@ -58,6 +59,9 @@ void web_portal_register_routes(AsyncWebServer* server) {
 		#if HEALTH_HISTORY_ENABLED
 		registerOptions("/api/health/history");
 		#endif
+		#if HEALTH_STREAM_ENABLED
+		web_portal_health_stream_register(server);
+		#endif
 		registerOptions("/api/health");
 		server->on("/api/health", HTTP_GET, handleGetHealth);
 
@@ -0,0 +1,57 @@
+#ifndef BOARD_OVERRIDES_ESP32S3_HEADLESS_H
+#define BOARD_OVERRIDES_ESP32S3_HEADLESS_H
+
+// ============================================================================
+// ESP32-S3 Headless Render Benchmark Configuration Overrides
+// ============================================================================
+// Any ESP32-S3 dev board with PSRAM, no panel or touch attached.
+// Runs the full LVGL render path into an in-memory framebuffer and logs
+// per-screen frame statistics over serial (see display_benchmark.h).
+//
+// Notes:
+// - Resolution matches the JC3248W535 so results are comparable with the
+//   real QSPI board minus panel transfer time.
+
+// ============================================================================
+// Display Configuration
+// ============================================================================
+// Enable display support on this board.
+#define HAS_DISPLAY true
+
+// ============================================================================
+// Driver Selection (HAL)
+// ============================================================================
+// Display backend: in-memory RGB565 framebuffer (no panel I/O)
+// Select the headless driver as the display HAL backend.
+#define DISPLAY_DRIVER DISPLAY_DRIVER_HEADLESS
+// Panel label for docs/tooling.
+#define DISPLAY_PANEL "none"
+
+// Framebuffer resolution (portrait)
+// Framebuffer width in pixels.
+#define DISPLAY_WIDTH  320
+// Framebuffer height in pixels.
+#define DISPLAY_HEIGHT 480
+
+// UI rotation (1 = 90° landscape, same as JC3248W535).
+#define DISPLAY_ROTATION 1
+
+// LVGL draw buffer size in pixels.
+#define LVGL_BUFFER_SIZE (DISPLAY_WIDTH * 80)
+
+// No backlight GPIO.
+#define HAS_BACKLIGHT false
+
+// ============================================================================
+// Touch Configuration
+// ============================================================================
+// No touch controller.
+#define HAS_TOUCH false
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run the display frame benchmark after boot.
+#define DISPLAY_BENCHMARK_ENABLED true
+
+#endif // BOARD_OVERRIDES_ESP32S3_HEADLESS_H
@@ -0,0 +1,220 @@
+// asset_codec.h: decode the blobs tools/png2lvgl_assets.py actually emits,
+// and reject malformed ones without writing outside the output buffer.
+//
+// tests/assets/asset_codec_{raw,rle,lz4,auto}.cpp are converter output for
+// the PNGs in tests/assets/png/, built against the lvgl.h stub. Regenerate
+// them after changing the converter or the blob format:
+//
+//   cd tests/assets
+//   python3 ../../tools/png2lvgl_assets.py png asset_codec_raw.cpp asset_codec_raw.h --prefix raw_ --compress none
+//   python3 ../../tools/png2lvgl_assets.py png asset_codec_rle.cpp asset_codec_rle.h --prefix rle_ --compress rle --compress-min-bytes 0
+//   python3 ../../tools/png2lvgl_assets.py png asset_codec_lz4.cpp asset_codec_lz4.h --prefix lz4_ --compress lz4 --compress-min-bytes 0
+//   python3 ../../tools/png2lvgl_assets.py png asset_codec_auto.cpp asset_codec_auto.h --prefix auto_ --compress auto --compress-min-bytes 0
+
+#include "asset_codec.h"
+#include "host_test.h"
+
+#include <lvgl.h>
+
+#include <initializer_list>
+#include <vector>
+
+// The generated headers share one include guard, so declare the images here.
+extern "C" {
+extern const lv_image_dsc_t raw_flat, raw_gradient, raw_logo, raw_noise, raw_stripes;
+extern const lv_image_dsc_t rle_flat, rle_gradient, rle_logo, rle_noise, rle_stripes;
+extern const lv_image_dsc_t lz4_flat, lz4_gradient, lz4_logo, lz4_noise, lz4_stripes;
+extern const lv_image_dsc_t auto_flat, auto_gradient, auto_logo, auto_noise, auto_stripes;
+}
+
+struct Fixture {
+		const char* name;
+		const lv_image_dsc_t* raw;
+		const lv_image_dsc_t* rle;
+		const lv_image_dsc_t* lz4;
+		const lv_image_dsc_t* automatic;
+};
+
+static const Fixture kFixtures[] = {
+		{"flat", &raw_flat, &rle_flat, &lz4_flat, &auto_flat},
+		{"gradient", &raw_gradient, &rle_gradient, &lz4_gradient, &auto_gradient},
+		{"logo", &raw_logo, &rle_logo, &lz4_logo, &auto_logo},
+		{"noise", &raw_noise, &rle_noise, &lz4_noise, &auto_noise},
+		{"stripes", &raw_stripes, &rle_stripes, &lz4_stripes, &auto_stripes},
+};
+
+static const uint8_t kCanary = 0xA5;
+static const size_t kGuard = 64;
+// Corrupted headers can claim any raw_size; don't allocate for absurd ones.
+static const uint32_t kMaxRawSize = 1u << 20;
+
+// Parse and decode a blob (copied to an exact-size buffer) into a buffer with
+// canary bytes on both sides. Returns the decoder's result; canaries that
+// changed count as a failure either way.
+static bool decode_guarded(const uint8_t* data, size_t len, std::vector<uint8_t>* out) {
+		const std::vector<uint8_t> blob(data, data + len);
+		AssetBlobInfo info = {};
+		if (!asset_blob_parse(blob.data(), blob.size(), &info)) return false;
+		if (info.raw_size > kMaxRawSize) return false;
+
+		std::vector<uint8_t> buf(info.raw_size + 2 * kGuard, kCanary);
+		const bool ok = asset_blob_decode(&info, buf.data() + kGuard, info.raw_size);
+		for (size_t i = 0; i < kGuard; i++) {
+				CHECK_EQ(buf[i], kCanary);
+				CHECK_EQ(buf[kGuard + info.raw_size + i], kCanary);
+		}
+		if (out) out->assign(buf.begin() + kGuard, buf.end() - kGuard);
+		return ok;
+}
+
+static bool is_compressed(const lv_image_dsc_t* img) {
+		return (img->header.flags & LV_IMAGE_FLAGS_USER1) != 0;
+}
+
+// One converter output against the raw planes: compressed images must decode
+// byte-for-byte, raw ones (not worth compressing) must be the planes as-is.
+static void check_image(const char* name, const lv_image_dsc_t* raw, const lv_image_dsc_t* img, uint8_t method,
+		std::vector<uint8_t>* methods_seen) {
+		if (!is_compressed(img)) {
+				CHECK_EQ(img->data_size, raw->data_size);
+				CHECK(memcmp(img->data, raw->data, raw->data_size) == 0);
+				return;
+		}
+
+		AssetBlobInfo info = {};
+		CHECK(asset_blob_parse(img->data, img->data_size, &info));
+		CHECK_EQ(info.raw_size, raw->data_size);
+		if (method) CHECK_EQ(info.method, method);
+		methods_seen->push_back(info.method);
+
+		std::vector<uint8_t> decoded;
+		const bool ok = decode_guarded(img->data, img->data_size, &decoded);
+		if (!ok || decoded.size() != raw->data_size || memcmp(decoded.data(), raw->data, raw->data_size) != 0) {
+				fprintf(stderr, "%s (method %u): decode failed or differs from the raw planes\n", name, (unsigned)info.method);
+				CHECK(ok);
+				CHECK(decoded.size() == raw->data_size && memcmp(decoded.data(), raw->data, raw->data_size) == 0);
+		}
+
+		// Every truncation (header included) must be rejected.
+		for (size_t len = 0; len < img->data_size; len++) {
+				CHECK(!decode_guarded(img->data, len, nullptr));
+		}
+
+		// Corrupt each byte after the magic/method: the result may go either
+		// way, but nothing may be written outside the buffer.
+		std::vector<uint8_t> blob(img->data, img->data + img->data_size);
+		for (size_t i = 4; i < blob.size(); i++) {
+				for (uint8_t x : {0x01, 0x80, 0xFF}) {
+						blob[i] ^= x;
+						decode_guarded(blob.data(), blob.size(), nullptr);
+						blob[i] ^= x;
+				}
+		}
+}
+
+static void test_converter_output() {
+		std::vector<uint8_t> rle, lz4, automatic;
+		for (const Fixture& f : kFixtures) {
+				CHECK(!is_compressed(f.raw));
+				CHECK_EQ(f.raw->data_size, (uint32_t)f.raw->header.w * f.raw->header.h * 3);
+				check_image(f.name, f.raw, f.rle, ASSET_METHOD_RLE, &rle);
+				check_image(f.name, f.raw, f.lz4, ASSET_METHOD_LZ4, &lz4);
+				check_image(f.name, f.raw, f.automatic, 0, &automatic);
+		}
+
+		// Guard against fixtures that stopped exercising the decoders.
+		CHECK(rle.size() >= 3);
+		CHECK(lz4.size() >= 4);
+		bool auto_rle = false, auto_lz4 = false;
+		for (uint8_t m : automatic) {
+				auto_rle |= m == ASSET_METHOD_RLE;
+				auto_lz4 |= m == ASSET_METHOD_LZ4;
+		}
+		CHECK(auto_rle && auto_lz4);
+		CHECK(automatic.size() < sizeof(kFixtures) / sizeof(kFixtures[0]));  // noise stays raw
+}
+
+static std::vector<uint8_t> make_blob(uint8_t method, uint8_t unit0, uint32_t raw_size, uint32_t split,
+		std::initializer_list<uint8_t> payload) {
+		std::vector<uint8_t> b = {'A', 'C', method, unit0,
+				(uint8_t)raw_size, (uint8_t)(raw_size >> 8), (uint8_t)(raw_size >> 16), (uint8_t)(raw_size >> 24),
+				(uint8_t)split, (uint8_t)(split >> 8), (uint8_t)(split >> 16), (uint8_t)(split >> 24)};
+		b.insert(b.end(), payload);
+		return b;
+}
+
+static bool decode_blob(const std::vector<uint8_t>& b, std::vector<uint8_t>* out = nullptr) {
+		return decode_guarded(b.data(), b.size(), out);
+}
+
+static void test_malformed_headers() {
+		AssetBlobInfo info = {};
+		CHECK(!asset_blob_parse(nullptr, 16, &info));
+		CHECK(!decode_blob(make_blob('X', 1, 4, 0, {0x03, 1, 2, 3, 4})));
+		CHECK(!decode_blob(make_blob(0, 1, 4, 0, {0x03, 1, 2, 3, 4})));
+		CHECK(!decode_blob(make_blob(3, 1, 4, 0, {0x03, 1, 2, 3, 4})));
+		// RLE: zero unit, split past the end, split not a whole number of units.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 0, 4, 2, {0x83, 7})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 2, 4, 6, {0x81, 7, 7})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 2, 4, 3, {0x81, 7, 7})));
+		std::vector<uint8_t> magic = make_blob(ASSET_METHOD_RLE, 1, 4, 0, {0x83, 7});
+		magic[1] = 'D';
+		CHECK(!decode_blob(magic));
+}
+
+static void test_malformed_rle() {
+		std::vector<uint8_t> out;
+		// Well-formed: 2 x 2-byte run in part 0, then a 2-byte literal in part 1.
+		CHECK(decode_blob(make_blob(ASSET_METHOD_RLE, 2, 6, 4, {0x81, 0x34, 0x12, 0x01, 9, 8}), &out));
+		CHECK(out == std::vector<uint8_t>({0x34, 0x12, 0x34, 0x12, 9, 8}));
+
+		// Run or literal longer than the output.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 1, 4, 0, {0x84, 7})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 1, 4, 0, {0x04, 1, 2, 3, 4, 5})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 2, 4, 4, {0x82, 1, 2})));
+		// Literal or run element past the end of the payload.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 1, 4, 0, {0x03, 1, 2})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 1, 4, 0, {0x83})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 2, 4, 4, {0x81, 1})));
+		// Payload left over after the output is complete.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 1, 4, 0, {0x83, 7, 0})));
+		// Part 0 ends early and never reaches part 1.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_RLE, 2, 6, 4, {0x81, 1, 2})));
+}
+
+static void test_malformed_lz4() {
+		std::vector<uint8_t> out;
+		// Well-formed: literal 'A' + overlapping match (offset 1, length 4), then literal 'B'.
+		CHECK(decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 6, 0, {0x10, 'A', 0x01, 0x00, 0x10, 'B'}), &out));
+		CHECK(out == std::vector<uint8_t>({'A', 'A', 'A', 'A', 'A', 'B'}));
+		// Literal length with 255 extension bytes: 15 + 255 + 10 = 280 literals.
+		std::vector<uint8_t> long_lit = make_blob(ASSET_METHOD_LZ4, 0, 280, 0, {0xF0, 255, 10});
+		long_lit.resize(long_lit.size() + 280, 0x5A);
+		CHECK(decode_blob(long_lit, &out));
+		CHECK(out == std::vector<uint8_t>(280, 0x5A));
+
+		// Literal length past the payload, and past the output.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 300, 0, {0xF0, 255, 10, 1, 2, 3})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 4, 0, {0x50, 1, 2, 3, 4, 5})));
+		// Literal length extension that runs off the end.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 300, 0, {0xF0, 255, 255})));
+		// Match length past the output (4 + 15 + 0 = 19 into 7 bytes), and an
+		// extension that runs off the end.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 8, 0, {0x1F, 'A', 0x01, 0x00, 0x00})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 600, 0, {0x1F, 'A', 0x01, 0x00, 255, 255})));
+		// Offset 0, offset before the start of the output, truncated offset.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 5, 0, {0x10, 'A', 0x00, 0x00})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 5, 0, {0x10, 'A', 0x02, 0x00})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 5, 0, {0x20, 'A', 'B', 0xFF, 0xFF})));
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 5, 0, {0x10, 'A', 0x01})));
+		// Stream ends short of raw_size.
+		CHECK(!decode_blob(make_blob(ASSET_METHOD_LZ4, 0, 8, 0, {0x10, 'A', 0x01, 0x00})));
+}
+
+int main() {
+		test_converter_output();
+		test_malformed_headers();
+		test_malformed_rle();
+		test_malformed_lz4();
+		return host_test_result("asset_codec_test");
+}
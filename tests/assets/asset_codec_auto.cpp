@@ -0,0 +1,468 @@
+/*
+ * Auto-generated PNG asset definitions
+ * Generated by tools/png2lvgl_assets.py
+ * DO NOT EDIT MANUALLY
+ */
+
+#include "asset_codec_auto.h"
+
+#if HAS_DISPLAY
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_
+#define LV_ATTRIBUTE_IMG_
+#endif
+
+// 32x24 RGBA PNG: flat.png
+// LZ4 compressed: 2304 -> 36 bytes (inflated by lvgl_asset_decoder.cpp)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ uint8_t auto_flat_map[] = {
+  0x41, 0x43, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x9f, 0x1c, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
+  0xff, 0x01, 0x00, 0xff, 0xff, 0xe9, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+const lv_image_dsc_t auto_flat = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
+    .flags = LV_IMAGE_FLAGS_USER1,
+    .w = 32,
+    .h = 24,
+    .stride = 64,
+    .reserved_2 = 0,
+  },
+  .data_size = 36,
+  .data = auto_flat_map,
+};
+
+// 40x24 RGBA PNG: gradient.png
+// LZ4 compressed: 2880 -> 1993 bytes (inflated by lvgl_asset_decoder.cpp)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ uint8_t auto_gradient_map[] = {
+  0x41, 0x43, 0x02, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1f, 0x00, 0x1f,
+  0x00, 0x1e, 0x08, 0x1d, 0x10, 0x1c, 0x18, 0x1c, 0x18, 0x1b, 0x20, 0x1a,
+  0x28, 0x19, 0x30, 0x19, 0x30, 0x18, 0x38, 0x17, 0x40, 0x16, 0x48, 0x16,
+  0x48, 0x15, 0x50, 0x14, 0x58, 0x13, 0x60, 0x13, 0x60, 0x12, 0x68, 0x11,
+  0x70, 0x10, 0x78, 0x10, 0x78, 0x0f, 0x80, 0x0e, 0x88, 0x0d, 0x90, 0x0d,
+  0x90, 0x0c, 0x98, 0x0b, 0xa0, 0x0a, 0xa8, 0x0a, 0xa8, 0x09, 0xb0, 0x08,
+  0xb8, 0x07, 0xc0, 0x07, 0xc0, 0x06, 0xc8, 0x05, 0xd0, 0x04, 0xd8, 0x04,
+  0xd8, 0x03, 0xe0, 0x02, 0xe8, 0x5f, 0x00, 0x5f, 0x00, 0x5e, 0x08, 0x5d,
+  0x10, 0x5c, 0x18, 0x5c, 0x18, 0x5b, 0x20, 0x5a, 0x28, 0x59, 0x30, 0x59,
+  0x30, 0x58, 0x38, 0x57, 0x40, 0x56, 0x48, 0x56, 0x48, 0x55, 0x50, 0x54,
+  0x58, 0x53, 0x60, 0x53, 0x60, 0x52, 0x68, 0x51, 0x70, 0x50, 0x78, 0x50,
+  0x78, 0x4f, 0x80, 0x4e, 0x88, 0x4d, 0x90, 0x4d, 0x90, 0x4c, 0x98, 0x4b,
+  0xa0, 0x4a, 0xa8, 0x4a, 0xa8, 0x49, 0xb0, 0x48, 0xb8, 0x47, 0xc0, 0x47,
+  0xc0, 0x46, 0xc8, 0x45, 0xd0, 0x44, 0xd8, 0x44, 0xd8, 0x43, 0xe0, 0x42,
+  0xe8, 0xbf, 0x00, 0xbf, 0x00, 0xbe, 0x08, 0xbd, 0x10, 0xbc, 0x18, 0xbc,
+  0x18, 0xbb, 0x20, 0xba, 0x28, 0xb9, 0x30, 0xb9, 0x30, 0xb8, 0x38, 0xb7,
+  0x40, 0xb6, 0x48, 0xb6, 0x48, 0xb5, 0x50, 0xb4, 0x58, 0xb3, 0x60, 0xb3,
+  0x60, 0xb2, 0x68, 0xb1, 0x70, 0xb0, 0x78, 0xb0, 0x78, 0xaf, 0x80, 0xae,
+  0x88, 0xad, 0x90, 0xad, 0x90, 0xac, 0x98, 0xab, 0xa0, 0xaa, 0xa8, 0xaa,
+  0xa8, 0xa9, 0xb0, 0xa8, 0xb8, 0xa7, 0xc0, 0xa7, 0xc0, 0xa6, 0xc8, 0xa5,
+  0xd0, 0xa4, 0xd8, 0xa4, 0xd8, 0xa3, 0xe0, 0xa2, 0xe8, 0xff, 0x00, 0xff,
+  0x00, 0xfe, 0x08, 0xfd, 0x10, 0xfc, 0x18, 0xfc, 0x18, 0xfb, 0x20, 0xfa,
+  0x28, 0xf9, 0x30, 0xf9, 0x30, 0xf8, 0x38, 0xf7, 0x40, 0xf6, 0x48, 0xf6,
+  0x48, 0xf5, 0x50, 0xf4, 0x58, 0xf3, 0x60, 0xf3, 0x60, 0xf2, 0x68, 0xf1,
+  0x70, 0xf0, 0x78, 0xf0, 0x78, 0xef, 0x80, 0xee, 0x88, 0xed, 0x90, 0xed,
+  0x90, 0xec, 0x98, 0xeb, 0xa0, 0xea, 0xa8, 0xea, 0xa8, 0xe9, 0xb0, 0xe8,
+  0xb8, 0xe7, 0xc0, 0xe7, 0xc0, 0xe6, 0xc8, 0xe5, 0xd0, 0xe4, 0xd8, 0xe4,
+  0xd8, 0xe3, 0xe0, 0xe2, 0xe8, 0x5f, 0x01, 0x5f, 0x01, 0x5e, 0x09, 0x5d,
+  0x11, 0x5c, 0x19, 0x5c, 0x19, 0x5b, 0x21, 0x5a, 0x29, 0x59, 0x31, 0x59,
+  0x31, 0x58, 0x39, 0x57, 0x41, 0x56, 0x49, 0x56, 0x49, 0x55, 0x51, 0x54,
+  0x59, 0x53, 0x61, 0x53, 0x61, 0x52, 0x69, 0x51, 0x71, 0x50, 0x79, 0x50,
+  0x79, 0x4f, 0x81, 0x4e, 0x89, 0x4d, 0x91, 0x4d, 0x91, 0x4c, 0x99, 0x4b,
+  0xa1, 0x4a, 0xa9, 0x4a, 0xa9, 0x49, 0xb1, 0x48, 0xb9, 0x47, 0xc1, 0x47,
+  0xc1, 0x46, 0xc9, 0x45, 0xd1, 0x44, 0xd9, 0x44, 0xd9, 0x43, 0xe1, 0x42,
+  0xe9, 0x9f, 0x01, 0x9f, 0x01, 0x9e, 0x09, 0x9d, 0x11, 0x9c, 0x19, 0x9c,
+  0x19, 0x9b, 0x21, 0x9a, 0x29, 0x99, 0x31, 0x99, 0x31, 0x98, 0x39, 0x97,
+  0x41, 0x96, 0x49, 0x96, 0x49, 0x95, 0x51, 0x94, 0x59, 0x93, 0x61, 0x93,
+  0x61, 0x92, 0x69, 0x91, 0x71, 0x90, 0x79, 0x90, 0x79, 0x8f, 0x81, 0x8e,
+  0x89, 0x8d, 0x91, 0x8d, 0x91, 0x8c, 0x99, 0x8b, 0xa1, 0x8a, 0xa9, 0x8a,
+  0xa9, 0x89, 0xb1, 0x88, 0xb9, 0x87, 0xc1, 0x87, 0xc1, 0x86, 0xc9, 0x85,
+  0xd1, 0x84, 0xd9, 0x84, 0xd9, 0x83, 0xe1, 0x82, 0xe9, 0xff, 0x01, 0xff,
+  0x01, 0xfe, 0x09, 0xfd, 0x11, 0xfc, 0x19, 0xfc, 0x19, 0xfb, 0x21, 0xfa,
+  0x29, 0xf9, 0x31, 0xf9, 0x31, 0xf8, 0x39, 0xf7, 0x41, 0xf6, 0x49, 0xf6,
+  0x49, 0xf5, 0x51, 0xf4, 0x59, 0xf3, 0x61, 0xf3, 0x61, 0xf2, 0x69, 0xf1,
+  0x71, 0xf0, 0x79, 0xf0, 0x79, 0xef, 0x81, 0xee, 0x89, 0xed, 0x91, 0xed,
+  0x91, 0xec, 0x99, 0xeb, 0xa1, 0xea, 0xa9, 0xea, 0xa9, 0xe9, 0xb1, 0xe8,
+  0xb9, 0xe7, 0xc1, 0xe7, 0xc1, 0xe6, 0xc9, 0xe5, 0xd1, 0xe4, 0xd9, 0xe4,
+  0xd9, 0xe3, 0xe1, 0xe2, 0xe9, 0x3f, 0x02, 0x3f, 0x02, 0x3e, 0x0a, 0x3d,
+  0x12, 0x3c, 0x1a, 0x3c, 0x1a, 0x3b, 0x22, 0x3a, 0x2a, 0x39, 0x32, 0x39,
+  0x32, 0x38, 0x3a, 0x37, 0x42, 0x36, 0x4a, 0x36, 0x4a, 0x35, 0x52, 0x34,
+  0x5a, 0x33, 0x62, 0x33, 0x62, 0x32, 0x6a, 0x31, 0x72, 0x30, 0x7a, 0x30,
+  0x7a, 0x2f, 0x82, 0x2e, 0x8a, 0x2d, 0x92, 0x2d, 0x92, 0x2c, 0x9a, 0x2b,
+  0xa2, 0x2a, 0xaa, 0x2a, 0xaa, 0x29, 0xb2, 0x28, 0xba, 0x27, 0xc2, 0x27,
+  0xc2, 0x26, 0xca, 0x25, 0xd2, 0x24, 0xda, 0x24, 0xda, 0x23, 0xe2, 0x22,
+  0xea, 0x9f, 0x02, 0x9f, 0x02, 0x9e, 0x0a, 0x9d, 0x12, 0x9c, 0x1a, 0x9c,
+  0x1a, 0x9b, 0x22, 0x9a, 0x2a, 0x99, 0x32, 0x99, 0x32, 0x98, 0x3a, 0x97,
+  0x42, 0x96, 0x4a, 0x96, 0x4a, 0x95, 0x52, 0x94, 0x5a, 0x93, 0x62, 0x93,
+  0x62, 0x92, 0x6a, 0x91, 0x72, 0x90, 0x7a, 0x90, 0x7a, 0x8f, 0x82, 0x8e,
+  0x8a, 0x8d, 0x92, 0x8d, 0x92, 0x8c, 0x9a, 0x8b, 0xa2, 0x8a, 0xaa, 0x8a,
+  0xaa, 0x89, 0xb2, 0x88, 0xba, 0x87, 0xc2, 0x87, 0xc2, 0x86, 0xca, 0x85,
+  0xd2, 0x84, 0xda, 0x84, 0xda, 0x83, 0xe2, 0x82, 0xea, 0xdf, 0x02, 0xdf,
+  0x02, 0xde, 0x0a, 0xdd, 0x12, 0xdc, 0x1a, 0xdc, 0x1a, 0xdb, 0x22, 0xda,
+  0x2a, 0xd9, 0x32, 0xd9, 0x32, 0xd8, 0x3a, 0xd7, 0x42, 0xd6, 0x4a, 0xd6,
+  0x4a, 0xd5, 0x52, 0xd4, 0x5a, 0xd3, 0x62, 0xd3, 0x62, 0xd2, 0x6a, 0xd1,
+  0x72, 0xd0, 0x7a, 0xd0, 0x7a, 0xcf, 0x82, 0xce, 0x8a, 0xcd, 0x92, 0xcd,
+  0x92, 0xcc, 0x9a, 0xcb, 0xa2, 0xca, 0xaa, 0xca, 0xaa, 0xc9, 0xb2, 0xc8,
+  0xba, 0xc7, 0xc2, 0xc7, 0xc2, 0xc6, 0xca, 0xc5, 0xd2, 0xc4, 0xda, 0xc4,
+  0xda, 0xc3, 0xe2, 0xc2, 0xea, 0x3f, 0x03, 0x3f, 0x03, 0x3e, 0x0b, 0x3d,
+  0x13, 0x3c, 0x1b, 0x3c, 0x1b, 0x3b, 0x23, 0x3a, 0x2b, 0x39, 0x33, 0x39,
+  0x33, 0x38, 0x3b, 0x37, 0x43, 0x36, 0x4b, 0x36, 0x4b, 0x35, 0x53, 0x34,
+  0x5b, 0x33, 0x63, 0x33, 0x63, 0x32, 0x6b, 0x31, 0x73, 0x30, 0x7b, 0x30,
+  0x7b, 0x2f, 0x83, 0x2e, 0x8b, 0x2d, 0x93, 0x2d, 0x93, 0x2c, 0x9b, 0x2b,
+  0xa3, 0x2a, 0xab, 0x2a, 0xab, 0x29, 0xb3, 0x28, 0xbb, 0x27, 0xc3, 0x27,
+  0xc3, 0x26, 0xcb, 0x25, 0xd3, 0x24, 0xdb, 0x24, 0xdb, 0x23, 0xe3, 0x22,
+  0xeb, 0x7f, 0x03, 0x7f, 0x03, 0x7e, 0x0b, 0x7d, 0x13, 0x7c, 0x1b, 0x7c,
+  0x1b, 0x7b, 0x23, 0x7a, 0x2b, 0x79, 0x33, 0x79, 0x33, 0x78, 0x3b, 0x77,
+  0x43, 0x76, 0x4b, 0x76, 0x4b, 0x75, 0x53, 0x74, 0x5b, 0x73, 0x63, 0x73,
+  0x63, 0x72, 0x6b, 0x71, 0x73, 0x70, 0x7b, 0x70, 0x7b, 0x6f, 0x83, 0x6e,
+  0x8b, 0x6d, 0x93, 0x6d, 0x93, 0x6c, 0x9b, 0x6b, 0xa3, 0x6a, 0xab, 0x6a,
+  0xab, 0x69, 0xb3, 0x68, 0xbb, 0x67, 0xc3, 0x67, 0xc3, 0x66, 0xcb, 0x65,
+  0xd3, 0x64, 0xdb, 0x64, 0xdb, 0x63, 0xe3, 0x62, 0xeb, 0xdf, 0x03, 0xdf,
+  0x03, 0xde, 0x0b, 0xdd, 0x13, 0xdc, 0x1b, 0xdc, 0x1b, 0xdb, 0x23, 0xda,
+  0x2b, 0xd9, 0x33, 0xd9, 0x33, 0xd8, 0x3b, 0xd7, 0x43, 0xd6, 0x4b, 0xd6,
+  0x4b, 0xd5, 0x53, 0xd4, 0x5b, 0xd3, 0x63, 0xd3, 0x63, 0xd2, 0x6b, 0xd1,
+  0x73, 0xd0, 0x7b, 0xd0, 0x7b, 0xcf, 0x83, 0xce, 0x8b, 0xcd, 0x93, 0xcd,
+  0x93, 0xcc, 0x9b, 0xcb, 0xa3, 0xca, 0xab, 0xca, 0xab, 0xc9, 0xb3, 0xc8,
+  0xbb, 0xc7, 0xc3, 0xc7, 0xc3, 0xc6, 0xcb, 0xc5, 0xd3, 0xc4, 0xdb, 0xc4,
+  0xdb, 0xc3, 0xe3, 0xc2, 0xeb, 0x1f, 0x04, 0x1f, 0x04, 0x1e, 0x0c, 0x1d,
+  0x14, 0x1c, 0x1c, 0x1c, 0x1c, 0x1b, 0x24, 0x1a, 0x2c, 0x19, 0x34, 0x19,
+  0x34, 0x18, 0x3c, 0x17, 0x44, 0x16, 0x4c, 0x16, 0x4c, 0x15, 0x54, 0x14,
+  0x5c, 0x13, 0x64, 0x13, 0x64, 0x12, 0x6c, 0x11, 0x74, 0x10, 0x7c, 0x10,
+  0x7c, 0x0f, 0x84, 0x0e, 0x8c, 0x0d, 0x94, 0x0d, 0x94, 0x0c, 0x9c, 0x0b,
+  0xa4, 0x0a, 0xac, 0x0a, 0xac, 0x09, 0xb4, 0x08, 0xbc, 0x07, 0xc4, 0x07,
+  0xc4, 0x06, 0xcc, 0x05, 0xd4, 0x04, 0xdc, 0x04, 0xdc, 0x03, 0xe4, 0x02,
+  0xec, 0x7f, 0x04, 0x7f, 0x04, 0x7e, 0x0c, 0x7d, 0x14, 0x7c, 0x1c, 0x7c,
+  0x1c, 0x7b, 0x24, 0x7a, 0x2c, 0x79, 0x34, 0x79, 0x34, 0x78, 0x3c, 0x77,
+  0x44, 0x76, 0x4c, 0x76, 0x4c, 0x75, 0x54, 0x74, 0x5c, 0x73, 0x64, 0x73,
+  0x64, 0x72, 0x6c, 0x71, 0x74, 0x70, 0x7c, 0x70, 0x7c, 0x6f, 0x84, 0x6e,
+  0x8c, 0x6d, 0x94, 0x6d, 0x94, 0x6c, 0x9c, 0x6b, 0xa4, 0x6a, 0xac, 0x6a,
+  0xac, 0x69, 0xb4, 0x68, 0xbc, 0x67, 0xc4, 0x67, 0xc4, 0x66, 0xcc, 0x65,
+  0xd4, 0x64, 0xdc, 0x64, 0xdc, 0x63, 0xe4, 0x62, 0xec, 0xbf, 0x04, 0xbf,
+  0x04, 0xbe, 0x0c, 0xbd, 0x14, 0xbc, 0x1c, 0xbc, 0x1c, 0xbb, 0x24, 0xba,
+  0x2c, 0xb9, 0x34, 0xb9, 0x34, 0xb8, 0x3c, 0xb7, 0x44, 0xb6, 0x4c, 0xb6,
+  0x4c, 0xb5, 0x54, 0xb4, 0x5c, 0xb3, 0x64, 0xb3, 0x64, 0xb2, 0x6c, 0xb1,
+  0x74, 0xb0, 0x7c, 0xb0, 0x7c, 0xaf, 0x84, 0xae, 0x8c, 0xad, 0x94, 0xad,
+  0x94, 0xac, 0x9c, 0xab, 0xa4, 0xaa, 0xac, 0xaa, 0xac, 0xa9, 0xb4, 0xa8,
+  0xbc, 0xa7, 0xc4, 0xa7, 0xc4, 0xa6, 0xcc, 0xa5, 0xd4, 0xa4, 0xdc, 0xa4,
+  0xdc, 0xa3, 0xe4, 0xa2, 0xec, 0x1f, 0x05, 0x1f, 0x05, 0x1e, 0x0d, 0x1d,
+  0x15, 0x1c, 0x1d, 0x1c, 0x1d, 0x1b, 0x25, 0x1a, 0x2d, 0x19, 0x35, 0x19,
+  0x35, 0x18, 0x3d, 0x17, 0x45, 0x16, 0x4d, 0x16, 0x4d, 0x15, 0x55, 0x14,
+  0x5d, 0x13, 0x65, 0x13, 0x65, 0x12, 0x6d, 0x11, 0x75, 0x10, 0x7d, 0x10,
+  0x7d, 0x0f, 0x85, 0x0e, 0x8d, 0x0d, 0x95, 0x0d, 0x95, 0x0c, 0x9d, 0x0b,
+  0xa5, 0x0a, 0xad, 0x0a, 0xad, 0x09, 0xb5, 0x08, 0xbd, 0x07, 0xc5, 0x07,
+  0xc5, 0x06, 0xcd, 0x05, 0xd5, 0x04, 0xdd, 0x04, 0xdd, 0x03, 0xe5, 0x02,
+  0xed, 0x5f, 0x05, 0x5f, 0x05, 0x5e, 0x0d, 0x5d, 0x15, 0x5c, 0x1d, 0x5c,
+  0x1d, 0x5b, 0x25, 0x5a, 0x2d, 0x59, 0x35, 0x59, 0x35, 0x58, 0x3d, 0x57,
+  0x45, 0x56, 0x4d, 0x56, 0x4d, 0x55, 0x55, 0x54, 0x5d, 0x53, 0x65, 0x53,
+  0x65, 0x52, 0x6d, 0x51, 0x75, 0x50, 0x7d, 0x50, 0x7d, 0x4f, 0x85, 0x4e,
+  0x8d, 0x4d, 0x95, 0x4d, 0x95, 0x4c, 0x9d, 0x4b, 0xa5, 0x4a, 0xad, 0x4a,
+  0xad, 0x49, 0xb5, 0x48, 0xbd, 0x47, 0xc5, 0x47, 0xc5, 0x46, 0xcd, 0x45,
+  0xd5, 0x44, 0xdd, 0x44, 0xdd, 0x43, 0xe5, 0x42, 0xed, 0xbf, 0x05, 0xbf,
+  0x05, 0xbe, 0x0d, 0xbd, 0x15, 0xbc, 0x1d, 0xbc, 0x1d, 0xbb, 0x25, 0xba,
+  0x2d, 0xb9, 0x35, 0xb9, 0x35, 0xb8, 0x3d, 0xb7, 0x45, 0xb6, 0x4d, 0xb6,
+  0x4d, 0xb5, 0x55, 0xb4, 0x5d, 0xb3, 0x65, 0xb3, 0x65, 0xb2, 0x6d, 0xb1,
+  0x75, 0xb0, 0x7d, 0xb0, 0x7d, 0xaf, 0x85, 0xae, 0x8d, 0xad, 0x95, 0xad,
+  0x95, 0xac, 0x9d, 0xab, 0xa5, 0xaa, 0xad, 0xaa, 0xad, 0xa9, 0xb5, 0xa8,
+  0xbd, 0xa7, 0xc5, 0xa7, 0xc5, 0xa6, 0xcd, 0xa5, 0xd5, 0xa4, 0xdd, 0xa4,
+  0xdd, 0xa3, 0xe5, 0xa2, 0xed, 0xff, 0x05, 0xff, 0x05, 0xfe, 0x0d, 0xfd,
+  0x15, 0xfc, 0x1d, 0xfc, 0x1d, 0xfb, 0x25, 0xfa, 0x2d, 0xf9, 0x35, 0xf9,
+  0x35, 0xf8, 0x3d, 0xf7, 0x45, 0xf6, 0x4d, 0xf6, 0x4d, 0xf5, 0x55, 0xf4,
+  0x5d, 0xf3, 0x65, 0xf3, 0x65, 0xf2, 0x6d, 0xf1, 0x75, 0xf0, 0x7d, 0xf0,
+  0x7d, 0xef, 0x85, 0xee, 0x8d, 0xed, 0x95, 0xed, 0x95, 0xec, 0x9d, 0xeb,
+  0xa5, 0xea, 0xad, 0xea, 0xad, 0xe9, 0xb5, 0xe8, 0xbd, 0xe7, 0xc5, 0xe7,
+  0xc5, 0xe6, 0xcd, 0xe5, 0xd5, 0xe4, 0xdd, 0xe4, 0xdd, 0xe3, 0xe5, 0xe2,
+  0xed, 0x5f, 0x06, 0x5f, 0x06, 0x5e, 0x0e, 0x5d, 0x16, 0x5c, 0x1e, 0x5c,
+  0x1e, 0x5b, 0x26, 0x5a, 0x2e, 0x59, 0x36, 0x59, 0x36, 0x58, 0x3e, 0x57,
+  0x46, 0x56, 0x4e, 0x56, 0x4e, 0x55, 0x56, 0x54, 0x5e, 0x53, 0x66, 0x53,
+  0x66, 0x52, 0x6e, 0x51, 0x76, 0x50, 0x7e, 0x50, 0x7e, 0x4f, 0x86, 0x4e,
+  0x8e, 0x4d, 0x96, 0x4d, 0x96, 0x4c, 0x9e, 0x4b, 0xa6, 0x4a, 0xae, 0x4a,
+  0xae, 0x49, 0xb6, 0x48, 0xbe, 0x47, 0xc6, 0x47, 0xc6, 0x46, 0xce, 0x45,
+  0xd6, 0x44, 0xde, 0x44, 0xde, 0x43, 0xe6, 0x42, 0xee, 0x9f, 0x06, 0x9f,
+  0x06, 0x9e, 0x0e, 0x9d, 0x16, 0x9c, 0x1e, 0x9c, 0x1e, 0x9b, 0x26, 0x9a,
+  0x2e, 0x99, 0x36, 0x99, 0x36, 0x98, 0x3e, 0x97, 0x46, 0x96, 0x4e, 0x96,
+  0x4e, 0x95, 0x56, 0x94, 0x5e, 0x93, 0x66, 0x93, 0x66, 0x92, 0x6e, 0x91,
+  0x76, 0x90, 0x7e, 0x90, 0x7e, 0x8f, 0x86, 0x8e, 0x8e, 0x8d, 0x96, 0x8d,
+  0x96, 0x8c, 0x9e, 0x8b, 0xa6, 0x8a, 0xae, 0x8a, 0xae, 0x89, 0xb6, 0x88,
+  0xbe, 0x87, 0xc6, 0x87, 0xc6, 0x86, 0xce, 0x85, 0xd6, 0x84, 0xde, 0x84,
+  0xde, 0x83, 0xe6, 0x82, 0xee, 0xff, 0x06, 0xff, 0x06, 0xfe, 0x0e, 0xfd,
+  0x16, 0xfc, 0x1e, 0xfc, 0x1e, 0xfb, 0x26, 0xfa, 0x2e, 0xf9, 0x36, 0xf9,
+  0x36, 0xf8, 0x3e, 0xf7, 0x46, 0xf6, 0x4e, 0xf6, 0x4e, 0xf5, 0x56, 0xf4,
+  0x5e, 0xf3, 0x66, 0xf3, 0x66, 0xf2, 0x6e, 0xf1, 0x76, 0xf0, 0x7e, 0xf0,
+  0x7e, 0xef, 0x86, 0xee, 0x8e, 0xed, 0x96, 0xed, 0x96, 0xec, 0x9e, 0xeb,
+  0xa6, 0xea, 0xae, 0xea, 0xae, 0xe9, 0xb6, 0xe8, 0xbe, 0xe7, 0xc6, 0xe7,
+  0xc6, 0xe6, 0xce, 0xe5, 0xd6, 0xe4, 0xde, 0xe4, 0xde, 0xe3, 0xe6, 0xe2,
+  0xee, 0x3f, 0x07, 0x3f, 0x07, 0x3e, 0x0f, 0x3d, 0x17, 0x3c, 0x1f, 0x3c,
+  0x1f, 0x3b, 0x27, 0x3a, 0x2f, 0x39, 0x37, 0x39, 0x37, 0x38, 0x3f, 0x37,
+  0x47, 0x36, 0x4f, 0x36, 0x4f, 0x35, 0x57, 0x34, 0x5f, 0x33, 0x67, 0x33,
+  0x67, 0x32, 0x6f, 0x31, 0x77, 0x30, 0x7f, 0x30, 0x7f, 0x2f, 0x87, 0x2e,
+  0x8f, 0x2d, 0x97, 0x2d, 0x97, 0x2c, 0x9f, 0x2b, 0xa7, 0x2a, 0xaf, 0x2a,
+  0xaf, 0x29, 0xb7, 0x28, 0xbf, 0x27, 0xc7, 0x27, 0xc7, 0x26, 0xcf, 0x25,
+  0xd7, 0x24, 0xdf, 0x24, 0xdf, 0x23, 0xe7, 0x22, 0xef, 0x00, 0x07, 0x0e,
+  0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62,
+  0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6,
+  0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0xff, 0xff,
+  0xff, 0x28, 0x00, 0xff, 0xff, 0xff, 0x83, 0x50, 0xf5, 0xfc, 0xff, 0xff,
+  0xff
+};
+
+const lv_image_dsc_t auto_gradient = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
+    .flags = LV_IMAGE_FLAGS_USER1,
+    .w = 40,
+    .h = 24,
+    .stride = 80,
+    .reserved_2 = 0,
+  },
+  .data_size = 1993,
+  .data = auto_gradient_map,
+};
+
+// 32x32 RGBA PNG: logo.png
+// LZ4 compressed: 3072 -> 1839 bytes (inflated by lvgl_asset_decoder.cpp)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ uint8_t auto_logo_map[] = {
+  0x41, 0x43, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf7, 0x10, 0x8a, 0x09, 0x87, 0x93, 0x47, 0xfd, 0x47, 0xfd, 0x67, 0x83,
+  0x8a, 0x09, 0x4a, 0x01, 0x68, 0x7b, 0xa7, 0x93, 0xe7, 0x9b, 0x47, 0x83,
+  0xe7, 0x9b, 0xa7, 0x93, 0x67, 0x7b, 0xe7, 0x93, 0x67, 0x10, 0x00, 0xf1,
+  0x26, 0x87, 0x7b, 0xe7, 0x9b, 0x67, 0x73, 0xe7, 0x93, 0x4a, 0x01, 0x8a,
+  0x09, 0x27, 0x7b, 0x27, 0xf5, 0x47, 0xfd, 0xc7, 0xa3, 0x89, 0x11, 0x27,
+  0x73, 0x27, 0xf5, 0xc9, 0x5a, 0xe9, 0x62, 0x68, 0xf5, 0xc8, 0x62, 0x0a,
+  0x01, 0x87, 0x83, 0xa7, 0x9b, 0x07, 0xa4, 0x67, 0x8b, 0x07, 0xa4, 0xc7,
+  0x9b, 0x87, 0x83, 0x06, 0x9c, 0xa7, 0x10, 0x00, 0xf0, 0x2b, 0x47, 0x8b,
+  0xe7, 0xa3, 0xa7, 0x9b, 0xa7, 0x8b, 0x06, 0xa4, 0x87, 0x83, 0x07, 0x9c,
+  0x0a, 0x01, 0x88, 0x52, 0x47, 0xf5, 0x09, 0x6b, 0x89, 0x52, 0x28, 0xed,
+  0x67, 0x8b, 0x87, 0xd4, 0x88, 0x8b, 0xea, 0x00, 0xea, 0x00, 0xe8, 0xa3,
+  0x07, 0xb4, 0xea, 0x00, 0x67, 0x83, 0xa7, 0x9b, 0xe7, 0xa3, 0x67, 0x83,
+  0xe7, 0x9b, 0xc7, 0x93, 0x87, 0x7b, 0x07, 0x9c, 0x50, 0x00, 0x30, 0xe7,
+  0xa3, 0x67, 0x40, 0x00, 0x10, 0x93, 0x50, 0x00, 0xf0, 0x23, 0x67, 0x7b,
+  0x07, 0x9c, 0xea, 0x00, 0xc7, 0xa3, 0x48, 0xbc, 0xe9, 0x00, 0xea, 0x00,
+  0x28, 0x7b, 0xc7, 0xe4, 0xe7, 0xa3, 0xc8, 0xd4, 0x89, 0x11, 0xa9, 0x19,
+  0xe8, 0xe4, 0x47, 0x8b, 0x0a, 0x01, 0x88, 0x4a, 0xa8, 0x52, 0xc8, 0x5a,
+  0x89, 0x4a, 0xc9, 0x52, 0xc9, 0x52, 0x89, 0x42, 0xe8, 0x5a, 0x88, 0x42,
+  0x10, 0x00, 0x51, 0x88, 0x4a, 0xc8, 0x5a, 0xa8, 0x10, 0x00, 0x00, 0x14,
+  0x00, 0xf0, 0x1d, 0x2a, 0x01, 0x07, 0x7b, 0x28, 0xed, 0xe9, 0x21, 0x69,
+  0x09, 0x88, 0xc4, 0x06, 0xbc, 0xe9, 0x21, 0x87, 0xd4, 0x27, 0xed, 0x27,
+  0xed, 0x66, 0xc4, 0xa9, 0x19, 0x4a, 0x01, 0xe8, 0x5a, 0x08, 0x6b, 0x48,
+  0x73, 0xa8, 0x52, 0x28, 0x6b, 0x08, 0x63, 0xe8, 0x5a, 0x48, 0x73, 0x10,
+  0x00, 0x91, 0x28, 0x73, 0xc8, 0x5a, 0x28, 0x73, 0xe8, 0x62, 0xc8, 0x10,
+  0x00, 0xf0, 0x0e, 0x48, 0x6b, 0x4a, 0x01, 0x89, 0x11, 0x27, 0xbc, 0x27,
+  0xf5, 0x07, 0xed, 0xa6, 0xdc, 0x08, 0x32, 0x8a, 0x09, 0xa9, 0x19, 0xa8,
+  0x5a, 0xa8, 0x5a, 0xa9, 0x11, 0x8a, 0x09, 0x8a, 0x04, 0x00, 0xa1, 0x09,
+  0x8a, 0x09, 0xea, 0x21, 0xea, 0x21, 0xca, 0x19, 0x69, 0x0c, 0x00, 0x02,
+  0x02, 0x00, 0x90, 0x69, 0x09, 0xea, 0x19, 0xeb, 0x21, 0xca, 0x19, 0x6a,
+  0x14, 0x00, 0xf0, 0x08, 0x11, 0x8a, 0x09, 0x89, 0x11, 0x88, 0x52, 0xc7,
+  0x62, 0xc9, 0x19, 0x8a, 0x09, 0x6a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x0a,
+  0x01, 0x2a, 0x01, 0x26, 0x00, 0x01, 0x44, 0x00, 0x80, 0x11, 0x2b, 0x2a,
+  0x2b, 0x2a, 0xea, 0x21, 0x89, 0x2a, 0x00, 0x03, 0x02, 0x00, 0x90, 0x89,
+  0x09, 0x0b, 0x2a, 0x4b, 0x32, 0xea, 0x21, 0x69, 0x14, 0x00, 0x41, 0x09,
+  0x8a, 0x11, 0x4a, 0x32, 0x00, 0xf0, 0x05, 0x2a, 0x01, 0x6a, 0x01, 0x28,
+  0x63, 0x46, 0xac, 0xa8, 0x4a, 0xa7, 0x83, 0x07, 0x9c, 0xea, 0x21, 0x4b,
+  0x32, 0x2b, 0x2a, 0x42, 0x00, 0x20, 0x69, 0x09, 0x02, 0x00, 0x10, 0x8a,
+  0x3c, 0x00, 0x00, 0x30, 0x00, 0x01, 0x02, 0x00, 0x00, 0x12, 0x00, 0x00,
+  0x14, 0x00, 0x11, 0x89, 0x82, 0x00, 0xf0, 0x0b, 0xc7, 0x8b, 0xe7, 0x9b,
+  0x89, 0x42, 0x27, 0xa4, 0x68, 0x7b, 0xa9, 0x4a, 0x67, 0x83, 0x29, 0x32,
+  0xe8, 0x62, 0x27, 0x73, 0xca, 0x19, 0x0b, 0x22, 0xea, 0x21, 0x40, 0x00,
+  0x02, 0x02, 0x00, 0x11, 0x89, 0x38, 0x00, 0x00, 0x08, 0x00, 0x04, 0x0a,
+  0x00, 0x00, 0x3e, 0x00, 0xf0, 0x0f, 0xca, 0x11, 0xaa, 0x11, 0x89, 0x09,
+  0x08, 0x6b, 0x27, 0x73, 0x29, 0x2a, 0x47, 0x7b, 0xc8, 0x5a, 0x48, 0x6b,
+  0x86, 0xbc, 0xa9, 0x4a, 0xa7, 0x93, 0x27, 0xac, 0xc9, 0x19, 0x69, 0x01,
+  0x62, 0x00, 0x6e, 0x8a, 0x11, 0x6a, 0x09, 0x4a, 0x01, 0x02, 0x00, 0x20,
+  0x6a, 0x01, 0x86, 0x00, 0x11, 0x0a, 0xda, 0x00, 0xf4, 0x04, 0xe7, 0x9b,
+  0x07, 0xa4, 0x89, 0x42, 0x46, 0xb4, 0x88, 0x83, 0x69, 0x3a, 0x07, 0x63,
+  0x09, 0x2a, 0xa8, 0x4a, 0xe8, 0x42, 0x01, 0x9a, 0x11, 0x6a, 0x01, 0x48,
+  0x4a, 0x46, 0x93, 0x26, 0x8b, 0x02, 0x00, 0xf0, 0x14, 0x46, 0x93, 0x88,
+  0x52, 0x6a, 0x09, 0x69, 0x09, 0x0a, 0x22, 0xea, 0x21, 0x6a, 0x09, 0xc8,
+  0x52, 0xc8, 0x5a, 0x09, 0x2a, 0x08, 0x63, 0x88, 0x42, 0x48, 0x6b, 0xa6,
+  0xbc, 0xa8, 0x52, 0xc7, 0x93, 0x47, 0xb4, 0xc9, 0x72, 0x01, 0x9e, 0x11,
+  0x89, 0x11, 0x4a, 0x01, 0xe7, 0x7a, 0x24, 0xfd, 0x02, 0x00, 0x60, 0xe5,
+  0x92, 0x29, 0x01, 0x89, 0x11, 0x9c, 0x01, 0xf0, 0x0b, 0x89, 0x09, 0x07,
+  0xa4, 0x26, 0xa4, 0xa9, 0x4a, 0x66, 0xbc, 0xa7, 0x83, 0x69, 0x3a, 0x08,
+  0x73, 0x09, 0x2a, 0xa8, 0x52, 0xe8, 0x62, 0xaa, 0x19, 0xca, 0x19, 0x9a,
+  0x01, 0x88, 0x4a, 0x01, 0xc7, 0x72, 0x45, 0xfd, 0x64, 0xf5, 0x02, 0x00,
+  0xa0, 0x84, 0xf5, 0x04, 0xfd, 0x66, 0x82, 0xe7, 0x00, 0x89, 0x11, 0x80,
+  0x00, 0xc2, 0x89, 0x09, 0xc8, 0x5a, 0xc8, 0x62, 0x09, 0x22, 0x08, 0x6b,
+  0x88, 0x4a, 0x00, 0x01, 0x80, 0xc7, 0x93, 0x26, 0xac, 0x0a, 0x2a, 0x2b,
+  0x2a, 0xb4, 0x01, 0x00, 0x40, 0x00, 0x1b, 0x44, 0x40, 0x00, 0xa0, 0x64,
+  0xf5, 0xe4, 0xfc, 0x46, 0x82, 0xc7, 0x00, 0x68, 0x11, 0x04, 0x01, 0x00,
+  0x80, 0x00, 0xb5, 0x07, 0xa4, 0xa9, 0x42, 0x66, 0xbc, 0x87, 0x83, 0xa9,
+  0x42, 0x47, 0x80, 0x01, 0x00, 0x7e, 0x01, 0x02, 0x80, 0x00, 0x0c, 0x40,
+  0x00, 0x11, 0x84, 0x40, 0x00, 0x60, 0xe7, 0x00, 0x07, 0x09, 0x69, 0x09,
+  0x5c, 0x02, 0x33, 0xe8, 0x62, 0x08, 0x80, 0x01, 0xef, 0x08, 0x5b, 0x07,
+  0x9c, 0x69, 0x42, 0x68, 0x7b, 0xa7, 0x8b, 0xea, 0x21, 0x0b, 0x22, 0x80,
+  0x00, 0x03, 0x24, 0x44, 0xf5, 0x40, 0x00, 0xa0, 0x06, 0x09, 0x27, 0x01,
+  0x0a, 0x22, 0xea, 0x19, 0x87, 0x7b, 0xfa, 0x00, 0xe0, 0xe7, 0x93, 0x48,
+  0x6b, 0xe9, 0x5a, 0xc7, 0x93, 0x69, 0x3a, 0x47, 0x73, 0x87, 0x83, 0x40,
+  0x00, 0x2f, 0x69, 0x09, 0x80, 0x00, 0x03, 0x02, 0xc0, 0x00, 0xf0, 0x0f,
+  0xe7, 0x00, 0x27, 0x09, 0xe6, 0x00, 0xa9, 0x19, 0xca, 0x19, 0x47, 0x7b,
+  0x67, 0x83, 0x49, 0x3a, 0xa7, 0x8b, 0x28, 0x6b, 0xc9, 0x4a, 0x87, 0x8b,
+  0x49, 0x32, 0x08, 0x6b, 0x47, 0x7b, 0xc0, 0x00, 0x2f, 0xea, 0x21, 0x00,
+  0x01, 0x09, 0x00, 0xc0, 0x00, 0xf0, 0x04, 0x06, 0x01, 0x67, 0x11, 0xca,
+  0x11, 0x28, 0x73, 0x27, 0x7b, 0x29, 0x32, 0x67, 0x8b, 0xe8, 0x62, 0x48,
+  0x6b, 0x66, 0x40, 0x02, 0x50, 0x8b, 0x06, 0xa4, 0xea, 0x21, 0xf8, 0x02,
+  0x06, 0x80, 0x00, 0x15, 0x44, 0x82, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x40,
+  0x01, 0x00, 0x40, 0x00, 0xaa, 0x07, 0x09, 0xe6, 0x00, 0x48, 0x09, 0xe7,
+  0x9b, 0xe7, 0xa3, 0x40, 0x02, 0x20, 0xc8, 0x5a, 0xc0, 0x02, 0x02, 0x40,
+  0x00, 0x60, 0xa7, 0x72, 0x45, 0xfd, 0x84, 0xf5, 0x36, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0xbe, 0x00, 0x01, 0x00, 0x01, 0x10, 0x7a, 0x00, 0x01, 0x71,
+  0x07, 0x01, 0x07, 0x01, 0x07, 0x09, 0xa7, 0x40, 0x02, 0xf0, 0x05, 0xe7,
+  0x62, 0x88, 0x42, 0x48, 0x73, 0x86, 0xc4, 0xa9, 0x52, 0xe7, 0x93, 0x46,
+  0xac, 0x0a, 0x2a, 0x4b, 0x32, 0x0a, 0x2a, 0x80, 0x00, 0x88, 0xe7, 0x7a,
+  0xe4, 0xfc, 0xa4, 0xf4, 0xa4, 0xfc, 0x02, 0x00, 0xf7, 0x09, 0x85, 0xfc,
+  0x66, 0x8a, 0xc7, 0x00, 0x07, 0x09, 0x07, 0x01, 0x06, 0x01, 0x06, 0x01,
+  0xc6, 0x8a, 0x06, 0xa4, 0xa8, 0x4a, 0x86, 0xbc, 0xa7, 0x8b, 0x40, 0x02,
+  0x61, 0x11, 0xea, 0x21, 0x2b, 0x32, 0x8a, 0xc0, 0x02, 0x59, 0xe5, 0x92,
+  0x66, 0x82, 0x46, 0x02, 0x00, 0x41, 0x86, 0x8a, 0xe6, 0x49, 0xc0, 0x00,
+  0x00, 0x80, 0x00, 0x91, 0x01, 0xc6, 0x49, 0x27, 0x52, 0xe9, 0x21, 0xe8,
+  0x6a, 0x40, 0x02, 0x32, 0xc4, 0xa9, 0x52, 0x40, 0x02, 0x20, 0x4b, 0x32,
+  0x40, 0x03, 0x99, 0x89, 0x11, 0x6a, 0x09, 0x08, 0x01, 0xe6, 0x00, 0xe7,
+  0x02, 0x00, 0x42, 0xc7, 0x00, 0xe7, 0x00, 0xbc, 0x00, 0x90, 0x07, 0x01,
+  0x27, 0x01, 0xa6, 0x92, 0x86, 0x92, 0x68, 0x40, 0x02, 0x00, 0x80, 0x00,
+  0x12, 0x6b, 0xc0, 0x02, 0x03, 0x82, 0x04, 0x10, 0x11, 0xb0, 0x03, 0x40,
+  0x89, 0x11, 0x27, 0x09, 0x2c, 0x01, 0x0b, 0x02, 0x00, 0x01, 0x7c, 0x00,
+  0x00, 0x02, 0x00, 0x54, 0xe6, 0x49, 0xc6, 0x51, 0x87, 0x80, 0x00, 0x10,
+  0xbc, 0xc0, 0x02, 0x00, 0xc0, 0x03, 0x11, 0x6a, 0x2e, 0x04, 0x95, 0x89,
+  0x11, 0x89, 0x09, 0x89, 0x09, 0x48, 0x09, 0x06, 0x2e, 0x00, 0x0d, 0x02,
+  0x00, 0xe1, 0x09, 0xa6, 0x8a, 0xa6, 0x92, 0xc6, 0x41, 0xe6, 0xb3, 0x88,
+  0x83, 0x8a, 0x01, 0x4a, 0xc2, 0x04, 0x00, 0x16, 0x06, 0x00, 0x3c, 0x00,
+  0x00, 0xe0, 0x02, 0x97, 0xea, 0x21, 0x4b, 0x3a, 0x2b, 0x32, 0xc9, 0x21,
+  0x47, 0x72, 0x00, 0x00, 0x76, 0x01, 0xa0, 0x06, 0x01, 0x88, 0x19, 0xe9,
+  0x29, 0x47, 0x11, 0x06, 0x01, 0xd0, 0x00, 0x00, 0xd2, 0x00, 0x20, 0x6a,
+  0x01, 0xf2, 0x02, 0x51, 0x68, 0x52, 0x68, 0x52, 0x89, 0x16, 0x05, 0x00,
+  0x2e, 0x05, 0x00, 0x04, 0x01, 0x20, 0xaa, 0x11, 0x02, 0x00, 0x00, 0x6e,
+  0x02, 0x01, 0x3a, 0x00, 0x01, 0x02, 0x00, 0x00, 0x36, 0x00, 0x21, 0x07,
+  0x01, 0xd8, 0x00, 0xf0, 0x10, 0x01, 0x06, 0x09, 0xc6, 0x41, 0xe6, 0x51,
+  0x06, 0x11, 0x48, 0x01, 0xc9, 0x19, 0x06, 0xc4, 0xa6, 0xe4, 0xa6, 0xec,
+  0xe6, 0xbb, 0xa9, 0x19, 0x6a, 0x01, 0x48, 0x52, 0x88, 0x62, 0xa8, 0x6a,
+  0x06, 0x00, 0xf1, 0x06, 0x68, 0x5a, 0x48, 0x4a, 0x67, 0x62, 0xe6, 0x49,
+  0x06, 0x5a, 0x06, 0x5a, 0xc6, 0x49, 0x27, 0x62, 0xe6, 0x59, 0xe6, 0x51,
+  0x26, 0x10, 0x00, 0x00, 0x86, 0x01, 0xf0, 0x3d, 0x06, 0xab, 0x26, 0xe4,
+  0x06, 0xdc, 0x66, 0xc3, 0x46, 0x21, 0x67, 0x9b, 0x46, 0xcc, 0xa9, 0x19,
+  0xc9, 0x21, 0x66, 0xdc, 0x07, 0x83, 0x4a, 0x01, 0x29, 0x3a, 0x28, 0x4a,
+  0x48, 0x4a, 0x29, 0x42, 0x48, 0x4a, 0x28, 0x4a, 0x08, 0x3a, 0x48, 0x4a,
+  0xe8, 0x39, 0xc6, 0x41, 0xc6, 0x49, 0xa7, 0x39, 0xe7, 0x49, 0xc6, 0x41,
+  0xa7, 0x39, 0xc6, 0x49, 0xa6, 0x39, 0xc6, 0x49, 0xc7, 0x00, 0x26, 0x6a,
+  0x06, 0xdc, 0x66, 0x21, 0x06, 0x11, 0xa6, 0xbb, 0xe6, 0xa2, 0x06, 0xcc,
+  0x78, 0x06, 0xf0, 0x15, 0x0a, 0x01, 0x87, 0x9b, 0x86, 0xab, 0x0a, 0x01,
+  0xa7, 0x72, 0xe7, 0x8a, 0x07, 0x93, 0xa7, 0x7a, 0x07, 0x8b, 0xe7, 0x82,
+  0xa7, 0x72, 0x07, 0x8b, 0xa7, 0x72, 0xa6, 0x82, 0x86, 0x8a, 0x46, 0x72,
+  0x86, 0x8a, 0x66, 0x82, 0x06, 0x00, 0xf1, 0x12, 0x26, 0x6a, 0x86, 0x8a,
+  0x87, 0x00, 0xc6, 0x92, 0x46, 0xab, 0x87, 0x00, 0x87, 0x00, 0x86, 0x72,
+  0xa6, 0xd3, 0xc7, 0x72, 0x86, 0xe4, 0x88, 0x52, 0xa8, 0x5a, 0x85, 0xec,
+  0x87, 0x62, 0x2a, 0x01, 0xc7, 0x40, 0x00, 0xf0, 0x04, 0xc7, 0x7a, 0x07,
+  0x93, 0xe7, 0x8a, 0xa7, 0x7a, 0x06, 0x93, 0xa7, 0x7a, 0xe7, 0x8a, 0xc7,
+  0x92, 0x26, 0x7a, 0x86, 0x50, 0x02, 0xe0, 0x7a, 0xa6, 0x8a, 0x46, 0x6a,
+  0x86, 0x8a, 0xa7, 0x00, 0xc6, 0x49, 0x06, 0xe4, 0x66, 0xcc, 0x00, 0xd0,
+  0xdc, 0x66, 0x7a, 0x8a, 0x09, 0x27, 0x93, 0x85, 0xec, 0x85, 0xec, 0x07,
+  0x83, 0x4c, 0x06, 0x2c, 0xa7, 0x6a, 0x80, 0x00, 0x65, 0xc7, 0x82, 0xe7,
+  0x92, 0x46, 0x7a, 0x80, 0x00, 0x30, 0x62, 0x86, 0x82, 0x46, 0x01, 0xb7,
+  0x46, 0x72, 0xe6, 0xe3, 0x06, 0xe4, 0xa6, 0x92, 0x07, 0x09, 0x00, 0x01,
+  0x00, 0x13, 0xff, 0x01, 0x00, 0x07, 0x13, 0x00, 0x06, 0x02, 0x00, 0x03,
+  0x1c, 0x00, 0x03, 0x02, 0x00, 0x06, 0x18, 0x00, 0x03, 0x02, 0x00, 0x03,
+  0x18, 0x00, 0x05, 0x02, 0x00, 0x03, 0x17, 0x00, 0x03, 0x02, 0x00, 0x05,
+  0x17, 0x00, 0x07, 0x02, 0x00, 0x03, 0x1b, 0x00, 0x00, 0x02, 0x00, 0x07,
+  0x16, 0x00, 0x07, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x02, 0x00, 0x07,
+  0x14, 0x00, 0x09, 0x02, 0x00, 0x01, 0x1d, 0x00, 0x0f, 0x1f, 0x00, 0x07,
+  0x04, 0x21, 0x00, 0x00, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x03, 0x00, 0x3e,
+  0x00, 0x1f, 0x00, 0x1b, 0x00, 0x03, 0x02, 0x02, 0x00, 0x0f, 0x1f, 0x00,
+  0x0c, 0x00, 0x21, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x0f,
+  0x20, 0x00, 0x0e, 0x0f, 0x3b, 0x00, 0x07, 0x0f, 0x02, 0x00, 0xd3, 0x0f,
+  0x7f, 0x01, 0x0a, 0x0f, 0x40, 0x01, 0x10, 0x0f, 0x40, 0x00, 0x0e, 0x0f,
+  0x21, 0x00, 0x0a, 0x0f, 0x01, 0x02, 0x0c, 0x01, 0x1f, 0x00, 0x0f, 0x41,
+  0x00, 0x08, 0x02, 0x20, 0x00, 0x0f, 0x21, 0x00, 0x06, 0x03, 0x1f, 0x00,
+  0x0f, 0x04, 0x02, 0x05, 0x00, 0x1a, 0x00, 0x03, 0x02, 0x00, 0x00, 0xeb,
+  0x00, 0x0c, 0x02, 0x00, 0x03, 0x1b, 0x00, 0x03, 0x02, 0x00, 0x0f, 0x1e,
+  0x00, 0x0b, 0x0d, 0x85, 0x00, 0x01, 0x13, 0x00, 0x0c, 0x02, 0x00, 0x04,
+  0x44, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+const lv_image_dsc_t auto_logo = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
+    .flags = LV_IMAGE_FLAGS_USER1,
+    .w = 32,
+    .h = 32,
+    .stride = 64,
+    .reserved_2 = 0,
+  },
+  .data_size = 1839,
+  .data = auto_logo_map,
+};
+
+// 8x8 RGBA PNG: noise.png
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ uint8_t auto_noise_map[] = {
+  0xf1, 0x33, 0x3c, 0x91, 0x59, 0xee, 0x94, 0x83, 0xc9, 0x85, 0xa0, 0x8a,
+  0x61, 0x3d, 0x58, 0x8b, 0x87, 0xe1, 0x9f, 0x59, 0x2d, 0x8f, 0x06, 0x94,
+  0x71, 0x2c, 0x9a, 0x0a, 0xde, 0x2e, 0x53, 0xc7, 0xfa, 0xee, 0x99, 0x87,
+  0xc4, 0xe7, 0x5c, 0xfc, 0xc1, 0xce, 0x90, 0xbf, 0x02, 0x9b, 0x98, 0x81,
+  0x13, 0x13, 0x96, 0x04, 0x89, 0x38, 0xb0, 0x03, 0xed, 0x5b, 0xe2, 0x95,
+  0xdf, 0x65, 0x34, 0x7e, 0xfb, 0x13, 0x70, 0xa9, 0x23, 0x43, 0x3f, 0x6c,
+  0x03, 0x46, 0xfb, 0x85, 0x0e, 0x47, 0xc9, 0x4a, 0xa2, 0x75, 0x5e, 0xec,
+  0xc3, 0x25, 0xc7, 0x26, 0x00, 0x51, 0x38, 0x12, 0x3d, 0x07, 0xa5, 0x0c,
+  0x80, 0x7c, 0xa7, 0x05, 0x1c, 0xce, 0x41, 0xb5, 0x93, 0x44, 0x64, 0xe0,
+  0x3b, 0xae, 0x21, 0xd3, 0xf8, 0xf3, 0xcc, 0x73, 0xe5, 0x23, 0x6c, 0x18,
+  0x4e, 0xdf, 0xf7, 0x22, 0x26, 0x66, 0x76, 0xf3, 0x82, 0x9b, 0x3c, 0xb7,
+  0x52, 0x23, 0x2a, 0xce, 0xba, 0x63, 0xf8, 0x3e, 0x3c, 0x3a, 0x56, 0xf8,
+  0x30, 0x78, 0x49, 0x09, 0xb1, 0xb6, 0xf0, 0x32, 0x0c, 0x80, 0x65, 0x87,
+  0xa9, 0x51, 0xc4, 0xf9, 0xf0, 0x34, 0x48, 0xe5, 0x36, 0xd6, 0x2e, 0x08,
+  0xd0, 0xa5, 0x31, 0x1a, 0x9c, 0x4c, 0xfd, 0x8a, 0x78, 0x3f, 0x96, 0x81,
+  0x6e, 0xe0, 0x80, 0xc0, 0x3d, 0x82, 0xe8, 0x90, 0x22, 0xeb, 0xba, 0xaa
+};
+
+const lv_image_dsc_t auto_noise = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
+    .flags = 0,
+    .w = 8,
+    .h = 8,
+    .stride = 16,
+    .reserved_2 = 0,
+  },
+  .data_size = 192,
+  .data = auto_noise_map,
+};
+
+// 32x32 RGBA PNG: stripes.png
+// RLE compressed: 3072 -> 170 bytes (inflated by lvgl_asset_decoder.cpp)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ uint8_t auto_stripes_map[] = {
+  0x41, 0x43, 0x01, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x9f, 0xe3, 0xfc, 0x9f, 0x31, 0xea, 0x9f, 0xc9, 0x98, 0x9f, 0xff, 0x0c,
+  0x9f, 0xeb, 0x95, 0x9f, 0x44, 0x0b, 0x9f, 0xf9, 0x74, 0x9f, 0xd6, 0xb2,
+  0x9f, 0x5b, 0xb5, 0x9f, 0xb3, 0x00, 0x9f, 0xcc, 0x54, 0x9f, 0x98, 0x3b,
+  0x9f, 0xd8, 0xe1, 0x9f, 0x2f, 0xe1, 0x9f, 0x0c, 0x6e, 0x9f, 0xde, 0x45,
+  0x9f, 0x6e, 0x29, 0x9f, 0x3e, 0x32, 0x9f, 0x24, 0xa6, 0x9f, 0x71, 0x3d,
+  0x9f, 0xa6, 0xef, 0x9f, 0x34, 0x17, 0x9f, 0x0c, 0x1e, 0x9f, 0xaa, 0x35,
+  0x9f, 0xcb, 0xd8, 0x9f, 0x7e, 0xdd, 0x9f, 0x7a, 0xda, 0x9f, 0xad, 0x7c,
+  0x9f, 0x0f, 0x3c, 0x9f, 0x4d, 0x6a, 0x9f, 0xce, 0x81, 0x9f, 0x33, 0x03,
+  0x9f, 0x59, 0x9f, 0xf3, 0x9f, 0x1c, 0x9f, 0xba, 0xbf, 0x43, 0x9f, 0xf3,
+  0x9f, 0x7e, 0x9f, 0x38, 0x9f, 0x8b, 0x9f, 0x66, 0x9f, 0x90, 0x9f, 0x39,
+  0x9f, 0x1e, 0x9f, 0x29, 0x9f, 0x3c, 0x9f, 0x73, 0x9f, 0xf1, 0x9f, 0xb8,
+  0x9f, 0x54, 0x9f, 0xb5, 0x9f, 0x07, 0x9f, 0x7c, 0x9f, 0x8f, 0x9f, 0x22,
+  0x9f, 0x60, 0x9f, 0x9a, 0x9f, 0x57, 0x9f, 0x1e, 0x9f, 0xc9, 0x9f, 0x75,
+  0x9f, 0x11
+};
+
+const lv_image_dsc_t auto_stripes = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
+    .flags = LV_IMAGE_FLAGS_USER1,
+    .w = 32,
+    .h = 32,
+    .stride = 64,
+    .reserved_2 = 0,
+  },
+  .data_size = 170,
+  .data = auto_stripes_map,
+};
+
+#endif // HAS_DISPLAY
@@ -0,0 +1,34 @@
+/*
+ * Auto-generated PNG asset declarations
+ * Generated by tools/png2lvgl_assets.py
+ * DO NOT EDIT MANUALLY
+ */
+
+#ifndef PNG_ASSETS_H
+#define PNG_ASSETS_H
+
+#include "board_config.h"
+
+#if HAS_DISPLAY
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PNG asset declarations
+// Compressed (LV_IMAGE_FLAGS_USER1) images: set them through lvgl_asset_src()
+// (lvgl_asset_decoder.h) so they are never drawn without the decoder.
+extern const lv_image_dsc_t lz4_flat;
+extern const lv_image_dsc_t lz4_gradient;
+extern const lv_image_dsc_t lz4_logo;
+extern const lv_image_dsc_t lz4_noise;
+extern const lv_image_dsc_t lz4_stripes;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAS_DISPLAY
+
+#endif // PNG_ASSETS_H
@@ -0,0 +1,32 @@
+/*
+ * Auto-generated PNG asset declarations
+ * Generated by tools/png2lvgl_assets.py
+ * DO NOT EDIT MANUALLY
+ */
+
+#ifndef PNG_ASSETS_H
+#define PNG_ASSETS_H
+
+#include "board_config.h"
+
+#if HAS_DISPLAY
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PNG asset declarations
+extern const lv_image_dsc_t raw_flat;
+extern const lv_image_dsc_t raw_gradient;
+extern const lv_image_dsc_t raw_logo;
+extern const lv_image_dsc_t raw_noise;
+extern const lv_image_dsc_t raw_stripes;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAS_DISPLAY
+
+#endif // PNG_ASSETS_H
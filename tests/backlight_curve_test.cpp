@@ -0,0 +1,78 @@
+// drivers/backlight_curve.h: duty mapping bounds and ramp monotonicity.
+
+#include "drivers/backlight_curve.h"
+#include "host_test.h"
+
+// Duty limits used by the drivers (full range and a typical dimmed panel).
+static const uint32_t kDutyLimits[][2] = {{0, 255}, {1, 255}, {10, 200}, {30, 254}, {0, 128}};
+
+static void test_duty_bounds() {
+		for (const auto& lim : kDutyLimits) {
+				const uint32_t duty_min = lim[0], duty_max = lim[1];
+				uint32_t prev = 0;
+				for (uint32_t b = 0; b < BACKLIGHT_Q8_FULL; b++) {
+						const uint32_t duty = backlight_duty_q8(b, duty_min, duty_max);
+						CHECK(duty <= duty_max);
+						CHECK(duty >= prev);
+						if (b >= BACKLIGHT_Q8_ONE) CHECK(duty >= duty_min);
+						prev = duty;
+				}
+				CHECK_EQ(backlight_duty_q8(0, duty_min, duty_max), 0);
+				CHECK_EQ(backlight_duty_q8(BACKLIGHT_Q8_ONE, duty_min, duty_max), duty_min);
+				CHECK_EQ(backlight_duty_q8(99 * BACKLIGHT_Q8_ONE, duty_min, duty_max), duty_max);
+				CHECK_EQ(backlight_duty_q8(BACKLIGHT_Q8_FULL - 1, duty_min, duty_max), duty_max);
+				CHECK_EQ(backlight_duty_q8(BACKLIGHT_Q8_FULL, duty_min, duty_max), 255);
+		}
+}
+
+// Walk a ramp at 1 ms steps: brightness and duty must only move towards the
+// target (no jitter) and land exactly on it.
+static void check_ramp(uint8_t from, uint8_t to, uint32_t duration_ms, float gamma) {
+		BacklightRamp r;
+		backlight_ramp_build(&r, from, to, duration_ms, gamma);
+		if (from > 100) from = 100;
+		if (to > 100) to = 100;
+		const bool up = to >= from;
+
+		CHECK_EQ(r.knot_q8[0], from * BACKLIGHT_Q8_ONE);
+		CHECK_EQ(r.knot_q8[BACKLIGHT_RAMP_KNOTS - 1], to * BACKLIGHT_Q8_ONE);
+
+		for (const auto& lim : kDutyLimits) {
+				uint32_t prev_b = backlight_ramp_at(&r, 0);
+				uint32_t prev_duty = backlight_duty_q8(prev_b, lim[0], lim[1]);
+				CHECK_EQ(prev_b, from * BACKLIGHT_Q8_ONE);
+				for (uint32_t t = 1; t <= duration_ms + 5; t++) {
+						const uint32_t b = backlight_ramp_at(&r, t);
+						const uint32_t duty = backlight_duty_q8(b, lim[0], lim[1]);
+						CHECK(up ? b >= prev_b : b <= prev_b);
+						CHECK(up ? duty >= prev_duty : duty <= prev_duty);
+						CHECK(b <= BACKLIGHT_Q8_FULL);
+						prev_b = b;
+						prev_duty = duty;
+				}
+				CHECK_EQ(prev_b, to * BACKLIGHT_Q8_ONE);
+		}
+}
+
+static void test_ramps() {
+		const uint8_t levels[] = {0, 1, 5, 50, 98, 99, 100};
+		const float gammas[] = {1.0f, 2.2f, 0.0f};
+		for (uint8_t from : levels) {
+				for (uint8_t to : levels) {
+						for (float gamma : gammas) {
+								check_ramp(from, to, 400, gamma);
+						}
+				}
+		}
+		// Short ramps: fewer milliseconds than knots.
+		check_ramp(0, 100, 3, 2.2f);
+		check_ramp(100, 0, 1, 2.2f);
+		// Out-of-range input is clamped to 100 %.
+		check_ramp(150, 0, 100, 2.2f);
+}
+
+int main() {
+		test_duty_bounds();
+		test_ramps();
+		return host_test_result("backlight_curve_test");
+}
@@ -0,0 +1,297 @@
+// Host frame benchmark: the DisplayManager render loop on Linux, no board.
+//
+// Real LVGL (LVGL_DIR), the real Headless_Driver and the built-in info, test,
+// fps and fps_complex screens, configured by src/boards/esp32s3-headless
+// (320x480, rotation 1, 80-line draw buffer) on top of the Arduino/FreeRTOS/
+// IDF stubs. Each pass is DisplayManager::lvglTask() for a Buffered driver:
+// lv_timer_handler() -> flushCallback() (setAddrWindow + pushColors into the
+// framebuffer) -> Screen::update() -> present(). present() runs inline rather
+// than on a second task.
+//
+// Prints one display_benchmark-style "Bench" line per screen (fps, pixels per
+// flush, lv_timer_handler()/present() min/avg/p50/p95/p99/max), so host and
+// on-device runs diff key by key. Absolute times are the host CPU's; compare
+// builds or screens against each other, not against the ESP32-S3.
+//
+//   frame_bench [window_ms]
+
+#include "board_config.h"
+#include "display_manager.h"
+#include "drivers/headless_driver.h"
+#include "log_manager.h"
+#include "ui_state.h"
+#include "host_test.h"
+
+#include <esp_timer.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Settle time after a switch before the window opens (display_benchmark.cpp).
+static const uint32_t kWarmupMs = 500;
+
+struct BenchScreen {
+		const char* id;
+		Screen* screen;
+		bool animated;  // Redraws every frame (test is static, info ticks once a second)
+};
+
+static Headless_Driver g_driver;
+static bool g_flush_pending = false;
+
+// Same accumulator as DisplayManager's g_bench, single-threaded.
+static bool g_bench_active = false;
+static DisplayBenchStats g_bench = {};
+static PerfHistogram g_bench_hist_lv_timer = {};
+static PerfHistogram g_bench_hist_present = {};
+
+// ~1 s perf window read by FpsScreen through display_manager_get_perf_stats().
+static DisplayPerfStats g_perf = {};
+static bool g_perf_ready = false;
+static uint32_t g_perf_window_start_ms = 0;
+static uint32_t g_perf_frames_in_window = 0;
+
+static inline void bench_add_sample(uint32_t value, uint32_t count, uint32_t* min_v, uint32_t* max_v) {
+		if (count == 0 || value < *min_v) *min_v = value;
+		if (count == 0 || value > *max_v) *max_v = value;
+}
+
+// ---------------------------------------------------------------------------
+// Firmware symbols the screens and driver link against
+// ---------------------------------------------------------------------------
+
+UiState g_ui_state;
+
+void log_write(LogLevel level, const char* module, const char* format, ...) {
+		if (level > LOG_LEVEL) return;
+		static const char kLevels[] = "?EWID";
+		fprintf(stderr, "[%lu] %c %s: ", millis(), kLevels[level < 5 ? level : 0], module);
+		va_list args;
+		va_start(args, format);
+		vfprintf(stderr, format, args);
+		va_end(args);
+		fputc('\n', stderr);
+}
+
+// Screens navigate through DisplayManager on tap; nothing taps here.
+void DisplayManager::showInfo() {}
+void DisplayManager::showTest() {}
+
+bool display_manager_get_perf_stats(DisplayPerfStats* out) {
+		if (!g_perf_ready || !out) return false;
+		*out = g_perf;
+		return true;
+}
+
+// LV_STDLIB_CUSTOM backend (lvgl_heap.cpp on the device).
+extern "C" void* lv_malloc_core(size_t size) { return malloc(size); }
+extern "C" void* lv_realloc_core(void* p, size_t new_size) { return realloc(p, new_size); }
+extern "C" void lv_free_core(void* p) { free(p); }
+extern "C" void lv_mem_init(void) {}
+extern "C" void lv_mem_deinit(void) {}
+extern "C" lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) { (void)mem; (void)bytes; return NULL; }
+extern "C" void lv_mem_remove_pool(lv_mem_pool_t pool) { (void)pool; }
+extern "C" void lv_mem_monitor_core(lv_mem_monitor_t* mon_p) { memset(mon_p, 0, sizeof(*mon_p)); }
+extern "C" lv_result_t lv_mem_test_core(void) { return LV_RESULT_OK; }
+
+// ---------------------------------------------------------------------------
+// Render loop
+// ---------------------------------------------------------------------------
+
+// DisplayManager::flushCallback() + pushArea() for a synchronous Buffered
+// driver (no coalescing, no byte swap).
+static void flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+		const uint32_t w = (area->x2 - area->x1 + 1);
+		const uint32_t h = (area->y2 - area->y1 + 1);
+		const uint32_t stride = lv_draw_buf_width_to_stride(w, lv_display_get_color_format(disp));
+
+		if (g_bench_active) {
+				bench_add_sample(w * h, g_bench.flushes, &g_bench.flush_pixels_min, &g_bench.flush_pixels_max);
+				g_bench.flushes++;
+				g_bench.flush_pixels += w * h;
+		}
+
+		g_driver.flushSrcStride = stride;
+		const bool swap = (g_driver.renderMode() != DisplayDriver::RenderMode::Buffered);
+		g_driver.startWrite();
+		g_driver.setAddrWindow(area->x1, area->y1, w, h);
+		g_driver.pushColors((uint16_t*)px_map, w * h, swap);
+		g_driver.endWrite();
+		if (g_bench_active) g_bench.transactions++;
+
+		g_flush_pending = true;
+		if (!g_driver.asyncFlush()) {
+				lv_display_flush_ready(disp);
+		}
+}
+
+// One lvglTask() pass; returns LVGL's suggested delay, clamped the same way.
+static uint32_t render_pass(Screen* screen) {
+		const uint64_t lv_start_us = esp_timer_get_time();
+		uint32_t delayMs = lv_timer_handler();
+		const uint32_t lv_timer_us = (uint32_t)(esp_timer_get_time() - lv_start_us);
+
+		if (screen) screen->update();
+
+		if (g_flush_pending) {
+				g_flush_pending = false;
+				if (g_bench_active) {
+						bench_add_sample(lv_timer_us, g_bench.frames, &g_bench.lv_timer_us_min, &g_bench.lv_timer_us_max);
+						g_bench.frames++;
+						g_bench.lv_timer_us_sum += lv_timer_us;
+						perf_hist_record(&g_bench_hist_lv_timer, lv_timer_us);
+				}
+
+				if (g_driver.commitFrame()) {
+						const uint64_t start_us = esp_timer_get_time();
+						g_driver.present();
+						const uint32_t present_us = (uint32_t)(esp_timer_get_time() - start_us);
+						if (g_bench_active) {
+								bench_add_sample(present_us, g_bench.presents, &g_bench.present_us_min, &g_bench.present_us_max);
+								g_bench.presents++;
+								g_bench.present_us_sum += present_us;
+								perf_hist_record(&g_bench_hist_present, present_us);
+						}
+
+						const uint32_t now_ms = millis();
+						if (g_perf_window_start_ms == 0) g_perf_window_start_ms = now_ms;
+						g_perf_frames_in_window++;
+						if (now_ms - g_perf_window_start_ms >= 1000) {
+								g_perf.fps = (uint16_t)g_perf_frames_in_window;
+								g_perf.lv_timer_us = lv_timer_us;
+								g_perf.present_us = present_us;
+								g_perf.bytes_per_frame = g_driver.lastPresentBytes();
+								g_perf_ready = true;
+								g_perf_window_start_ms = now_ms;
+								g_perf_frames_in_window = 0;
+						}
+				}
+		}
+
+		if (delayMs < 1) delayMs = 1;
+		if (delayMs > 20) delayMs = 20;
+		return delayMs;
+}
+
+static void run_for(Screen* screen, uint32_t ms) {
+		const uint32_t start_ms = millis();
+		while (millis() - start_ms < ms) {
+				usleep(render_pass(screen) * 1000);
+		}
+}
+
+static uint32_t avg_u32(uint64_t sum, uint32_t count) {
+		return count ? (uint32_t)(sum / count) : 0;
+}
+
+static void print_result(const char* screen_id, const DisplayBenchStats& s) {
+		const float fps = s.window_ms ? (s.frames * 1000.0f / (float)s.window_ms) : 0.0f;
+
+		printf("[Bench] screen=%s draw_units=%d window_ms=%lu frames=%lu fps=%.1f flushes=%lu transactions=%lu px_flush_avg=%lu px_flush_min=%lu px_flush_max=%lu lv_timer_us_avg=%lu lv_timer_us_min=%lu lv_timer_us_p50=%lu lv_timer_us_p95=%lu lv_timer_us_p99=%lu lv_timer_us_max=%lu presents=%lu present_us_avg=%lu present_us_min=%lu present_us_p50=%lu present_us_p95=%lu present_us_p99=%lu present_us_max=%lu\n",
+				screen_id,
+				(int)LV_DRAW_SW_DRAW_UNIT_CNT,
+				(unsigned long)s.window_ms,
+				(unsigned long)s.frames,
+				fps,
+				(unsigned long)s.flushes,
+				(unsigned long)s.transactions,
+				(unsigned long)avg_u32(s.flush_pixels, s.flushes),
+				(unsigned long)s.flush_pixels_min,
+				(unsigned long)s.flush_pixels_max,
+				(unsigned long)avg_u32(s.lv_timer_us_sum, s.frames),
+				(unsigned long)s.lv_timer_us_min,
+				(unsigned long)s.lv_timer_pct.p50_us,
+				(unsigned long)s.lv_timer_pct.p95_us,
+				(unsigned long)s.lv_timer_pct.p99_us,
+				(unsigned long)s.lv_timer_us_max,
+				(unsigned long)s.presents,
+				(unsigned long)avg_u32(s.present_us_sum, s.presents),
+				(unsigned long)s.present_us_min,
+				(unsigned long)s.present_pct.p50_us,
+				(unsigned long)s.present_pct.p95_us,
+				(unsigned long)s.present_pct.p99_us,
+				(unsigned long)s.present_us_max);
+}
+
+int main(int argc, char** argv) {
+		const uint32_t window_ms = argc > 1 ? (uint32_t)atoi(argv[1]) : DISPLAY_BENCHMARK_SCREEN_MS;
+
+		ui_text_publish(&g_ui_state.device_name, "frame_bench");
+		ui_text_publish(&g_ui_state.mdns_host, "frame-bench.local");
+		ui_text_publish(&g_ui_state.ip, "No IP");
+		ui_value_publish(&g_ui_state.heap_free_kb, 0);
+		ui_value_publish(&g_ui_state.cpu_pct, UI_CPU_UNKNOWN);
+
+		// DisplayManager::initHardware() / initLVGL() for this driver.
+		g_driver.init();
+		g_driver.setRotation(DISPLAY_ROTATION);
+		CHECK(g_driver.getFramebuffer() != nullptr);
+
+		lv_init();
+		lv_tick_set_cb([]() -> uint32_t { return (uint32_t)millis(); });
+
+		lv_display_t* display = lv_display_create(g_driver.width(), g_driver.height());
+		lv_display_set_flush_cb(display, flush_cb);
+		const size_t buf_size_bytes = LVGL_BUFFER_SIZE * sizeof(uint16_t);
+		uint8_t* buf = (uint8_t*)aligned_alloc(LV_DRAW_BUF_ALIGN, buf_size_bytes);
+		lv_display_set_buffers(display, buf, nullptr, buf_size_bytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
+		g_driver.configureLVGL(display, DISPLAY_ROTATION);
+		lv_theme_t* theme = lv_theme_default_init(display, lv_color_hex(0x3399FF), lv_color_hex(0x303030), true, LV_FONT_DEFAULT);
+		lv_display_set_theme(display, theme);
+		#ifdef LVGL_REFR_PERIOD_MS
+		lv_timer_set_period(lv_display_get_refr_timer(display), LVGL_REFR_PERIOD_MS);
+		#endif
+
+		{
+				InfoScreen infoScreen(nullptr);
+				TestScreen testScreen(nullptr);
+				FpsScreen fpsScreen(nullptr);
+				FpsScreen fpsComplexScreen(nullptr, true);
+				const BenchScreen screens[] = {
+						{"info", &infoScreen, false},
+						{"test", &testScreen, false},
+						{"fps", &fpsScreen, true},
+						{"fps_complex", &fpsComplexScreen, true},
+				};
+
+				Screen* current = nullptr;
+				for (const BenchScreen& s : screens) {
+						if (current) current->hide();
+						current = s.screen;
+						current->create();
+						current->show();
+						run_for(current, kWarmupMs);
+
+						g_bench = {};
+						perf_hist_reset(&g_bench_hist_lv_timer);
+						perf_hist_reset(&g_bench_hist_present);
+						const uint32_t start_ms = millis();
+						g_bench_active = true;
+						run_for(current, window_ms);
+						g_bench_active = false;
+						g_bench.window_ms = millis() - start_ms;
+						perf_hist_take(&g_bench_hist_lv_timer, &g_bench.lv_timer_pct);
+						perf_hist_take(&g_bench_hist_present, &g_bench.present_pct);
+
+						print_result(s.id, g_bench);
+
+						// An animated screen with no frames means the loop is broken.
+						if (s.animated) CHECK(g_bench.frames > 0);
+						CHECK(g_bench.flushes >= g_bench.frames);
+						CHECK_EQ(g_bench.presents, g_bench.frames);
+						CHECK(g_bench.flush_pixels_max <= (uint32_t)LVGL_BUFFER_SIZE);
+				}
+
+				// Rendered rows reached the framebuffer and were accounted for.
+				CHECK(g_driver.getPresentCount() > 0);
+				CHECK(g_driver.getPresentedPixels() > 0);
+
+				lv_screen_load(lv_obj_create(NULL));
+		}
+
+		lv_display_delete(display);
+		lv_deinit();
+		free(buf);
+
+		return host_test_result("frame_bench");
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// Minimal assertion helpers for the host tests: every failure is printed,
+// and the test's exit code is the number of failed checks.
+
+#include <stdio.h>
+
+static int g_host_test_failures = 0;
+
+#define CHECK(cond) do { \
+		if (!(cond)) { \
+				fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+				g_host_test_failures++; \
+		} \
+} while (0)
+
+#define CHECK_EQ(a, b) do { \
+		const long long _a = (long long)(a), _b = (long long)(b); \
+		if (_a != _b) { \
+				fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, _a, _b); \
+				g_host_test_failures++; \
+		} \
+} while (0)
+
+static inline int host_test_result(const char* name) {
+		if (g_host_test_failures) {
+				fprintf(stderr, "%s: %d check(s) failed\n", name, g_host_test_failures);
+		} else {
+				printf("%s: ok\n", name);
+		}
+		return g_host_test_failures ? 1 : 0;
+}
@@ -0,0 +1,60 @@
+// drivers/rgb565_copy.h: word-at-a-time vs per-pixel byte swap, in MB/s.
+//
+// Copies a 480x320 frame row by row into a framebuffer-sized destination,
+// once with full aligned rows and once with odd-width rows at an odd x
+// (source and destination 2 bytes out of phase). Outputs are compared so a
+// fast but wrong kernel fails the run. Host numbers only show the relative
+// cost of the two loops; on-device figures come from display_benchmark.
+//
+//   rgb565_copy_bench [reps]
+
+#include "drivers/rgb565_copy.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+static const uint32_t kFbWidth = 480;
+static const uint32_t kFbHeight = 320;
+
+typedef void (*SwapCopyFn)(uint16_t*, const uint16_t*, uint32_t);
+
+// Returns MB/s (bytes / us) for reps frames of rows × rowPx pixels.
+static double time_swap(SwapCopyFn fn, uint16_t* dst, const uint16_t* src, uint32_t rowPx, uint32_t dstOffsetPx, int reps) {
+		const auto t0 = std::chrono::steady_clock::now();
+		for (int f = 0; f < reps; f++) {
+				for (uint32_t r = 0; r < kFbHeight; r++) {
+						fn(dst + (size_t)r * kFbWidth + dstOffsetPx, src + (size_t)r * kFbWidth, rowPx);
+				}
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+		return us > 0 ? (double)rowPx * kFbHeight * sizeof(uint16_t) * reps / us : 0.0;
+}
+
+int main(int argc, char** argv) {
+		const int reps = argc > 1 ? atoi(argv[1]) : 200;
+		const size_t fbPx = (size_t)kFbWidth * kFbHeight;
+
+		std::vector<uint16_t> src(fbPx + 1);
+		for (size_t i = 0; i < src.size(); i++) src[i] = (uint16_t)((i * 2654435761u) >> 16);
+		std::vector<uint16_t> dstWord(fbPx), dstScalar(fbPx);
+
+		struct Case { const char* name; uint32_t rowPx; uint32_t dstOffsetPx; };
+		const Case cases[] = {
+				{ "aligned", kFbWidth, 0 },
+				{ "odd", kFbWidth - 3, 1 },
+		};
+
+		printf("%8s %12s %12s %8s\n", "case", "scalar MB/s", "word MB/s", "speedup");
+		for (const Case& c : cases) {
+				const double scalar = time_swap(rgb565_swap_copy_scalar, dstScalar.data(), src.data(), c.rowPx, c.dstOffsetPx, reps);
+				const double word = time_swap(rgb565_swap_copy, dstWord.data(), src.data(), c.rowPx, c.dstOffsetPx, reps);
+				CHECK(dstWord == dstScalar);
+				printf("%8s %12.1f %12.1f %7.2fx\n", c.name, scalar, word, scalar > 0 ? word / scalar : 0.0);
+		}
+
+		return host_test_result("rgb565_copy_bench");
+}
@@ -0,0 +1,142 @@
+// drivers/rgb565_copy.h: word-at-a-time swap and stride copy against the
+// per-pixel reference, for every width from 1 to 67 and both 4-byte phases
+// of source and destination.
+//
+// Every buffer is guarded by canary pixels on both sides and in the stride
+// padding, so a write past the requested pixels shows up as a mismatch.
+
+#include "drivers/rgb565_copy.h"
+#include "host_test.h"
+
+#include <initializer_list>
+#include <vector>
+
+static const uint16_t kCanary = 0xA5C3;
+static const uint32_t kGuardPx = 8;
+static const uint32_t kMaxWidth = 67;
+
+static uint16_t pattern(uint32_t i) {
+		return (uint16_t)((i * 2654435761u) >> 16);
+}
+
+// Guarded, 16-byte aligned pixel buffer; px() is the first usable pixel
+// plus a 0/1 pixel offset to select the 4-byte phase.
+struct GuardedBuf {
+		std::vector<uint16_t> storage;
+
+		explicit GuardedBuf(uint32_t px) : storage(px + 2 * kGuardPx + 8, kCanary) {}
+
+		uint16_t* base() {
+				uintptr_t p = (uintptr_t)(storage.data() + kGuardPx);
+				p = (p + 15) & ~(uintptr_t)15;
+				return (uint16_t*)p;
+		}
+};
+
+// Report the first differing pixel (if any) and count it as one failure.
+static void check_same(const std::vector<uint16_t>& got, const std::vector<uint16_t>& want, const char* what,
+		uint32_t w, uint32_t a, uint32_t b, uint32_t c) {
+		for (size_t i = 0; i < got.size(); i++) {
+				if (got[i] != want[i]) {
+						fprintf(stderr, "%s w=%u (%u,%u,%u): pixel %zu is %04x, expected %04x\n",
+										what, (unsigned)w, (unsigned)a, (unsigned)b, (unsigned)c, i, got[i], want[i]);
+						CHECK(got[i] == want[i]);
+						return;
+				}
+		}
+}
+
+static void test_swap_copy() {
+		for (uint32_t w = 1; w <= kMaxWidth; w++) {
+				for (uint32_t srcOff = 0; srcOff < 2; srcOff++) {
+						for (uint32_t dstOff = 0; dstOff < 2; dstOff++) {
+								GuardedBuf src(w + 1), got(w + 1), want(w + 1);
+								for (uint32_t i = 0; i < w; i++) src.base()[srcOff + i] = pattern(i + w);
+
+								rgb565_swap_copy(got.base() + dstOff, src.base() + srcOff, w);
+								rgb565_swap_copy_scalar(want.base() + dstOff, src.base() + srcOff, w);
+								check_same(got.storage, want.storage, "swap_copy", w, srcOff, dstOff, 0);
+						}
+
+						// In place (dst == src), as the TFT_eSPI DMA flush does on LVGL's buffer.
+						GuardedBuf got(w + 1), want(w + 1);
+						for (uint32_t i = 0; i < w; i++) {
+								got.base()[srcOff + i] = pattern(i + w);
+								want.base()[srcOff + i] = pattern(i + w);
+						}
+						rgb565_swap_copy(got.base() + srcOff, got.base() + srcOff, w);
+						rgb565_swap_copy_scalar(want.base() + srcOff, want.base() + srcOff, w);
+						check_same(got.storage, want.storage, "swap_copy in place", w, srcOff, srcOff, 0);
+				}
+		}
+
+		// Whole draw-buffer strips in place (320 x 15 px, and an odd-sized one
+		// starting 2 bytes into a word).
+		for (uint32_t n : {4800u, 4801u}) {
+				for (uint32_t off = 0; off < 2; off++) {
+						GuardedBuf got(n + 1), want(n + 1);
+						for (uint32_t i = 0; i < n; i++) {
+								got.base()[off + i] = pattern(i);
+								want.base()[off + i] = pattern(i);
+						}
+						rgb565_swap_copy(got.base() + off, got.base() + off, n);
+						rgb565_swap_copy_scalar(want.base() + off, want.base() + off, n);
+						check_same(got.storage, want.storage, "swap_copy strip in place", n, off, off, 0);
+				}
+		}
+
+		// n == 0 writes nothing.
+		GuardedBuf src(4), dst(4);
+		rgb565_swap_copy(dst.base() + 1, src.base(), 0);
+		for (uint16_t p : dst.storage) CHECK_EQ(p, kCanary);
+}
+
+static void test_copy_rect() {
+		const uint32_t kRows = 3;
+		const uint32_t kStridePad[] = {0, 1, 5};
+
+		for (uint32_t w = 1; w <= kMaxWidth; w++) {
+				for (uint32_t srcPad : kStridePad) {
+						for (uint32_t dstPad : kStridePad) {
+								const uint32_t srcStride = w + srcPad;
+								const uint32_t dstStride = w + dstPad;
+								for (uint32_t off = 0; off < 4; off++) {
+										const uint32_t srcOff = off & 1, dstOff = off >> 1;
+										for (int swap = 0; swap < 2; swap++) {
+												GuardedBuf src(srcStride * kRows + 1);
+												GuardedBuf got(dstStride * kRows + 1), want(dstStride * kRows + 1);
+												for (uint32_t i = 0; i < srcStride * kRows; i++) {
+														src.base()[srcOff + i] = pattern(i + w);
+												}
+
+												rgb565_copy_rect(got.base() + dstOff, dstStride, src.base() + srcOff, srcStride,
+																				 w, kRows, swap != 0);
+												for (uint32_t r = 0; r < kRows; r++) {
+														uint16_t* d = want.base() + dstOff + r * dstStride;
+														const uint16_t* s = src.base() + srcOff + r * srcStride;
+														if (swap) {
+																rgb565_swap_copy_scalar(d, s, w);
+														} else {
+																for (uint32_t c = 0; c < w; c++) d[c] = s[c];
+														}
+												}
+												check_same(got.storage, want.storage, swap ? "copy_rect swap" : "copy_rect",
+																	 w, srcStride, dstStride, off);
+										}
+								}
+						}
+				}
+		}
+
+		// Empty rectangles write nothing.
+		GuardedBuf src(16), dst(16);
+		rgb565_copy_rect(dst.base(), 4, src.base(), 4, 0, 3, true);
+		rgb565_copy_rect(dst.base(), 4, src.base(), 4, 4, 0, true);
+		for (uint16_t p : dst.storage) CHECK_EQ(p, kCanary);
+}
+
+int main() {
+		test_swap_copy();
+		test_copy_rect();
+		return host_test_result("rgb565_copy_test");
+}
@@ -0,0 +1,60 @@
+// drivers/rgb565_rotate.h: tiled vs per-pixel rotation, in MB/s per rotation.
+//
+// Copies a 320x480 portrait framebuffer's worth of pixels strip by strip
+// (the default LVGL_BUFFER_SIZE of 1/10 screen), the way a buffered driver's
+// present path sees them, and compares the two framebuffers afterwards.
+// Host caches are far larger than the ESP32-S3's, so the gap here is smaller
+// than on PSRAM; on-device figures come from display_benchmark.
+//
+//   rgb565_rotate_bench [reps]
+
+#include "drivers/rgb565_rotate.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+static const uint16_t kFbWidth = 320;
+static const uint16_t kFbHeight = 480;
+static const uint32_t kStripPx = (uint32_t)kFbWidth * kFbHeight / 10;
+
+typedef void (*RotateBlitFn)(uint16_t*, uint16_t, uint16_t, const uint16_t*, uint32_t, int16_t, int16_t, uint16_t, uint16_t, uint8_t);
+
+// Returns MB/s (bytes / us) for reps full frames through fn.
+static double time_rotate(RotateBlitFn fn, uint16_t* fb, const uint16_t* strip, uint8_t rotation, int reps) {
+		const uint16_t logicalW = (rotation & 1) ? kFbHeight : kFbWidth;
+		const uint16_t logicalH = (rotation & 1) ? kFbWidth : kFbHeight;
+		const uint16_t stripRows = (uint16_t)(kStripPx / logicalW);
+
+		const auto t0 = std::chrono::steady_clock::now();
+		for (int f = 0; f < reps; f++) {
+				for (uint16_t y = 0; y < logicalH; y += stripRows) {
+						const uint16_t h = (uint16_t)((logicalH - y) < stripRows ? (logicalH - y) : stripRows);
+						fn(fb, kFbWidth, kFbHeight, strip, logicalW, 0, (int16_t)y, logicalW, h, rotation);
+				}
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+		return us > 0 ? (double)kFbWidth * kFbHeight * sizeof(uint16_t) * reps / us : 0.0;
+}
+
+int main(int argc, char** argv) {
+		const int reps = argc > 1 ? atoi(argv[1]) : 200;
+		const size_t fbPx = (size_t)kFbWidth * kFbHeight;
+
+		std::vector<uint16_t> strip(kStripPx);
+		for (size_t i = 0; i < strip.size(); i++) strip[i] = (uint16_t)((i * 2654435761u) >> 16);
+
+		printf("%4s %12s %12s %8s\n", "rot", "scalar MB/s", "tiled MB/s", "speedup");
+		for (uint8_t rot = 0; rot < 4; rot++) {
+				std::vector<uint16_t> fbTiled(fbPx), fbScalar(fbPx);
+				const double scalar = time_rotate(rgb565_rotate_blit_scalar, fbScalar.data(), strip.data(), rot, reps);
+				const double tiled = time_rotate(rgb565_rotate_blit, fbTiled.data(), strip.data(), rot, reps);
+				CHECK(fbTiled == fbScalar);
+				printf("%4u %12.1f %12.1f %7.2fx\n", (unsigned)rot, scalar, tiled, scalar > 0 ? tiled / scalar : 0.0);
+		}
+
+		return host_test_result("rgb565_rotate_bench");
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// Host stand-in for the Arduino core: only what the headers under test use.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The ESP32 core's Arduino.h pulls in FreeRTOS (portMUX_TYPE etc.).
+#include <freertos/FreeRTOS.h>
+
+// Named in declarations only (config_manager.h).
+class String;
+
+static inline bool psramFound() { return true; }
+
+static inline unsigned long millis() {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (unsigned long)ts.tv_sec * 1000UL + (unsigned long)(ts.tv_nsec / 1000000L);
+}
+
+class EspClass {
+public:
+		const char* getChipModel() { return "Host"; }
+		uint8_t getChipRevision() { return 0; }
+};
+
+inline EspClass ESP;
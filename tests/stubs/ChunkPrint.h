@@ -0,0 +1,38 @@
+#pragma once
+
+// Host copy of ESPAsyncWebServer's ChunkPrint: keeps the bytes of one
+// [from, from + len) window of whatever is printed through it.
+
+#include <stddef.h>
+#include <stdint.h>
+
+class ChunkPrint {
+private:
+		uint8_t* _destination;
+		size_t _to_skip;
+		size_t _to_write;
+		size_t _pos;
+
+public:
+		ChunkPrint(uint8_t* destination, size_t from, size_t len)
+				: _destination(destination), _to_skip(from), _to_write(len), _pos(0) {}
+
+		size_t write(uint8_t c) {
+				if (_to_skip > 0) {
+						_to_skip--;
+						return 1;
+				}
+				if (_to_write > 0) {
+						_to_write--;
+						_destination[_pos++] = c;
+						return 1;
+				}
+				return 0;
+		}
+
+		size_t write(const uint8_t* buffer, size_t size) {
+				size_t n = 0;
+				while (size--) n += write(*buffer++);
+				return n;
+		}
+};
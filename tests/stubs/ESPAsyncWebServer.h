@@ -0,0 +1,58 @@
+#pragma once
+
+// Host stand-in for the ESPAsyncWebServer types web_portal_json.h touches.
+// A sent response is kept on the request so a test can drain its chunks the
+// way AsyncTCP would.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <functional>
+#include <string>
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebServerResponse {
+public:
+		int code = 200;
+		std::string contentType;
+		AwsResponseFiller filler;  // Chunked responses
+		std::string body;          // Stream responses
+
+		virtual ~AsyncWebServerResponse() = default;
+		void setCode(int c) { code = c; }
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse {
+public:
+		size_t print(const char* s) {
+				body += s;
+				return strlen(s);
+		}
+};
+
+class AsyncWebServerRequest {
+public:
+		AsyncWebServerResponse* sent = nullptr;
+
+		~AsyncWebServerRequest() { delete sent; }
+
+		AsyncWebServerResponse* beginChunkedResponse(const char* type, AwsResponseFiller callback) {
+				AsyncWebServerResponse* r = new AsyncWebServerResponse();
+				r->contentType = type;
+				r->filler = callback;
+				return r;
+		}
+
+		AsyncResponseStream* beginResponseStream(const char* type) {
+				AsyncResponseStream* r = new AsyncResponseStream();
+				r->contentType = type;
+				return r;
+		}
+
+		void send(AsyncWebServerResponse* response) {
+				delete sent;
+				sent = response;
+		}
+};
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in: info_screen.cpp includes this but only calls ESP.getChipModel()
+// and ESP.getChipRevision() (see Arduino.h).
@@ -0,0 +1,33 @@
+#pragma once
+
+// Host stand-in for ESP-IDF heap_caps_*: plain malloc, plus a hook that fails
+// the next N allocations so fallback paths can be exercised.
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+
+inline unsigned g_stub_heap_fail_next = 0;
+
+static inline bool stub_heap_should_fail() {
+		if (g_stub_heap_fail_next == 0) return false;
+		g_stub_heap_fail_next--;
+		return true;
+}
+
+static inline void* heap_caps_malloc(size_t size, unsigned caps) {
+		(void)caps;
+		return stub_heap_should_fail() ? nullptr : malloc(size);
+}
+
+static inline void* heap_caps_realloc(void* ptr, size_t size, unsigned caps) {
+		(void)caps;
+		return stub_heap_should_fail() ? nullptr : realloc(ptr, size);
+}
+
+static inline void heap_caps_free(void* ptr) {
+		free(ptr);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-in for ESP-IDF FreeRTOS: the types the display headers name,
+// and no-op critical sections (the host frame benchmark is single-threaded).
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint8_t StackType_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct {
+		int reserved;
+} StaticTask_t;
+
+typedef struct {
+		uint32_t owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#define tskNO_AFFINITY 0x7FFFFFFF
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct QueueDefinition* SemaphoreHandle_t;
@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-in for LVGL: only the image descriptor that
+// tools/png2lvgl_assets.py output (tests/assets/) is built from.
+
+#include <stdint.h>
+
+#define LV_IMAGE_HEADER_MAGIC 0x19
+#define LV_COLOR_FORMAT_RGB565A8 0x14
+#define LV_IMAGE_FLAGS_USER1 0x0100
+
+typedef struct {
+		uint32_t magic : 8;
+		uint32_t cf : 8;
+		uint32_t flags : 16;
+		uint32_t w : 16;
+		uint32_t h : 16;
+		uint32_t stride : 16;
+		uint32_t reserved_2 : 16;
+} lv_image_header_t;
+
+typedef struct {
+		lv_image_header_t header;
+		uint32_t data_size;
+		const uint8_t* data;
+} lv_image_dsc_t;
@@ -0,0 +1,129 @@
+// touch_gesture.h: replay recorded touch traces (tests/traces/*.trace)
+// through the filter and gesture recognizer the way TouchManager does.
+//
+// Trace format, one indev read per line:
+//   # expect: <gesture names, space separated, or none>
+//   t_ms pressed x y second x2 y2
+// Every trace is replayed with TOUCH_FILTER off and on.
+
+#include "touch_gesture.h"
+#include "host_test.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct TraceRow {
+		uint32_t t_ms;
+		bool pressed;
+		int16_t x, y;
+		bool second;
+		int16_t x2, y2;
+};
+
+struct Trace {
+		std::string name;
+		std::vector<std::string> expect;
+		std::vector<TraceRow> rows;
+};
+
+static bool load_trace(const std::filesystem::path& path, Trace* out) {
+		std::ifstream in(path);
+		if (!in) return false;
+		out->name = path.stem().string();
+		std::string line;
+		while (std::getline(in, line)) {
+				if (line.empty()) continue;
+				if (line[0] == '#') {
+						const std::string key = "# expect:";
+						if (line.compare(0, key.size(), key) == 0) {
+								std::istringstream names(line.substr(key.size()));
+								std::string n;
+								while (names >> n) {
+										if (n != "none") out->expect.push_back(n);
+								}
+						}
+						continue;
+				}
+				std::istringstream fields(line);
+				int t, p, x, y, s, x2, y2;
+				if (!(fields >> t >> p >> x >> y >> s >> x2 >> y2)) return false;
+				out->rows.push_back({(uint32_t)t, p != 0, (int16_t)x, (int16_t)y, s != 0, (int16_t)x2, (int16_t)y2});
+		}
+		return !out->rows.empty();
+}
+
+// Same order as TouchManager::processSample(): filter the primary contact,
+// reset the filter on release, then feed the recognizer.
+static std::vector<std::string> replay(const Trace& trace, bool filter) {
+		TouchFilter f;
+		touch_filter_init(&f, &kTouchFilterDefaults);
+		TouchGestureRecognizer g;
+		touch_gesture_init(&g, &kTouchGestureDefaults);
+
+		std::vector<std::string> got;
+		for (const TraceRow& r : trace.rows) {
+				int16_t x = r.pressed ? r.x : 0;
+				int16_t y = r.pressed ? r.y : 0;
+				if (filter) {
+						if (r.pressed) {
+								touch_filter_apply(&f, r.t_ms * 1000u, &x, &y);
+						} else {
+								touch_filter_reset(&f);
+						}
+				}
+				TouchGesture gesture;
+				if (touch_gesture_feed(&g, r.t_ms, r.pressed, x, y, r.second, r.x2, r.y2, &gesture)) {
+						got.push_back(touch_gesture_name(gesture.type));
+				}
+		}
+		return got;
+}
+
+static std::string join(const std::vector<std::string>& v) {
+		if (v.empty()) return "none";
+		std::string s;
+		for (const std::string& n : v) {
+				if (!s.empty()) s += ' ';
+				s += n;
+		}
+		return s;
+}
+
+int main(int argc, char** argv) {
+		if (argc < 2) {
+				fprintf(stderr, "usage: %s <trace dir>\n", argv[0]);
+				return 2;
+		}
+
+		std::vector<std::filesystem::path> paths;
+		for (const auto& entry : std::filesystem::directory_iterator(argv[1])) {
+				if (entry.path().extension() == ".trace") paths.push_back(entry.path());
+		}
+		std::sort(paths.begin(), paths.end());
+		CHECK(!paths.empty());
+
+		for (const auto& path : paths) {
+				Trace trace;
+				if (!load_trace(path, &trace)) {
+						fprintf(stderr, "%s: unreadable trace\n", path.string().c_str());
+						CHECK(false);
+						continue;
+				}
+				for (bool filter : {false, true}) {
+						const std::string got = join(replay(trace, filter));
+						const std::string want = join(trace.expect);
+						if (got != want) {
+								fprintf(stderr, "%s (filter %s): got %s, expected %s\n",
+												trace.name.c_str(), filter ? "on" : "off", got.c_str(), want.c_str());
+								CHECK(false);
+						} else {
+								printf("%-40s filter %-3s %s\n", trace.name.c_str(), filter ? "on" : "off", got.c_str());
+						}
+				}
+		}
+		return host_test_result("touch_gesture_test");
+}
@@ -0,0 +1,116 @@
+// web_portal_json.h: serialize-once vs per-chunk (ChunkPrint) response
+// bodies, drained at TCP-window sized chunks the way AsyncTCP asks for them.
+//
+// Both paths must produce exactly serializeJson()'s output; the timings show
+// what the serialize-once buffer saves per response.
+//
+//   web_portal_json_bench [reps]
+
+#include "web_portal_json.h"
+#include "host_test.h"
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+
+// Roughly /api/health and /api/config sized documents.
+static std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>> make_doc(size_t fields) {
+		auto doc = make_psram_json_doc(fields * 64 + 1024);
+		char key[40];
+		for (size_t i = 0; i < fields; i++) {
+				switch (i % 4) {
+						case 0:
+								snprintf(key, sizeof(key), "display_metric_%u_us", (unsigned)i);
+								(*doc)[key] = (uint32_t)(i * 7919u);
+								break;
+						case 1:
+								snprintf(key, sizeof(key), "heap_region_%u_bytes", (unsigned)i);
+								(*doc)[key] = (uint32_t)(8388608u - i * 4096u);
+								break;
+						case 2:
+								snprintf(key, sizeof(key), "feature_%u_enabled", (unsigned)i);
+								(*doc)[key] = (i % 3) != 0;
+								break;
+						default:
+								snprintf(key, sizeof(key), "label_%u", (unsigned)i);
+								(*doc)[key] = "esp32-template-device";
+								break;
+				}
+		}
+		return doc;
+}
+
+// Drain a chunked response into a string, max_len bytes per callback.
+static std::string drain(AsyncWebServerResponse* r, size_t max_len) {
+		std::string body;
+		uint8_t buf[4096];
+		for (size_t index = 0;;) {
+				const size_t n = r->filler(buf, max_len, index);
+				if (n == 0) break;
+				body.append((const char*)buf, n);
+				index += n;
+		}
+		return body;
+}
+
+struct PathResult {
+		std::string body;
+		double us_per_response;
+};
+
+static PathResult run_path(const std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>>& doc, bool serialize_once,
+		size_t window, int reps) {
+		PathResult res = {};
+		const auto t0 = std::chrono::steady_clock::now();
+		for (int i = 0; i < reps; i++) {
+				AsyncWebServerRequest request;
+				// The text buffer is the only heap_caps allocation the send call makes;
+				// failing both its PSRAM and internal attempts takes the ChunkPrint path.
+				if (!serialize_once) g_stub_heap_fail_next = 2;
+				web_portal_send_json_chunked(&request, doc);
+				g_stub_heap_fail_next = 0;
+				CHECK(request.sent && request.sent->filler);
+				if (!request.sent || !request.sent->filler) return res;
+				CHECK_EQ(request.sent->code, 200);
+				res.body = drain(request.sent, window);
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		res.us_per_response = std::chrono::duration<double, std::micro>(t1 - t0).count() / reps;
+		return res;
+}
+
+int main(int argc, char** argv) {
+		const int reps = argc > 1 ? atoi(argv[1]) : 200;
+		const size_t kFields[] = {40, 120, 400};
+		const size_t kWindows[] = {536, 1436, 2920};
+
+		printf("%8s %8s %7s %14s %14s %8s\n", "bytes", "window", "chunks", "per-chunk us", "once us", "speedup");
+		for (size_t fields : kFields) {
+				auto doc = make_doc(fields);
+				CHECK(!doc->overflowed());
+				std::string expected;
+				serializeJson(*doc, expected);
+
+				for (size_t window : kWindows) {
+						const PathResult chunked = run_path(doc, false, window, reps);
+						const PathResult once = run_path(doc, true, window, reps);
+						CHECK(chunked.body == expected);
+						CHECK(once.body == expected);
+						printf("%8zu %8zu %7zu %14.1f %14.1f %7.1fx\n",
+									 expected.size(), window, (expected.size() + window - 1) / window,
+									 chunked.us_per_response, once.us_per_response,
+									 once.us_per_response > 0 ? chunked.us_per_response / once.us_per_response : 0.0);
+				}
+		}
+
+		// Error paths keep their status codes.
+		{
+				AsyncWebServerRequest request;
+				auto empty = std::shared_ptr<BasicJsonDocument<PsramJsonAllocator>>();
+				web_portal_send_json_chunked(&request, empty);
+				CHECK(request.sent && request.sent->code == 503);
+		}
+
+		return host_test_result("web_portal_json_bench");
+}
@@ -136,9 +136,10 @@ get_chip_family_for_fqbn() {
 
 is_beta_board() {
   local board_name="$1"
-  # Conservative filter: exclude anything explicitly tagged beta/experimental.
+  # Conservative filter: exclude anything explicitly tagged beta/experimental,
+  # and headless benchmark builds (no panel; nothing to flash for end users).
   shopt -s nocasematch
-  if [[ "$board_name" == *"beta"* ]] || [[ "$board_name" == *"experimental"* ]]; then
+  if [[ "$board_name" == *"beta"* ]] || [[ "$board_name" == *"experimental"* ]] || [[ "$board_name" == *"-headless" ]]; then
     return 0
   fi
   return 1
@@ -159,6 +159,9 @@ def _detect_bus(defines: Dict[str, str]) -> str:
     driver = defines.get("DISPLAY_DRIVER", "")
     if "ST7703_DSI" in driver or "ST7701_DSI" in driver:
         return "DSI"
+    # Headless driver renders into RAM only
+    if "HEADLESS" in driver:
+        return "none"
     if any(k.startswith("TFT_") for k in defines.keys()) or "LCD_SCK_PIN" in defines:
         return "SPI"
     return "?"
@@ -165,6 +165,7 @@ declare -A JS_GZIP_CONTENTS
 declare -A ORIGINAL_SIZES
 declare -A PROCESSED_SIZES
 declare -A GZIPPED_SIZES
+declare -A ASSET_HASHES
 
 # Helper function to gzip content and generate C byte array
 gzip_to_c_array() {
@@ -183,58 +184,11 @@ gzip_to_c_array() {
     rm -f "$temp_file" "$temp_gz"
 }
 
-# Process HTML files (template substitution + minification)
-for html_file in "${HTML_FILES[@]}"; do
-    filename=$(basename "$html_file" .html)
-    echo "Processing HTML: $filename.html..."
-    content=$(cat "$html_file")
-    original_size=$(echo -n "$content" | wc -c)
-    
-    # Template substitution and minification
-    minified=$(python3 -c "
-import re
-import sys
-
-# Read template fragments from environment or files
-header_template = '''$HEADER_TEMPLATE'''
-nav_template = '''$NAV_TEMPLATE'''
-footer_template = '''$FOOTER_TEMPLATE'''
-
-with open('$html_file', 'r') as f:
-    html = f.read()
-    
-    # Replace template placeholders with actual content
-    html = html.replace('{{HEADER}}', header_template)
-    html = html.replace('{{NAV}}', nav_template)
-    html = html.replace('{{FOOTER}}', footer_template)
-    
-    # Project name substitution
-    html = html.replace('{{PROJECT_NAME}}', '$PROJECT_NAME')
-    html = html.replace('{{PROJECT_DISPLAY_NAME}}', '$PROJECT_DISPLAY_NAME')
-    
-    # Remove HTML comments
-    html = re.sub(r'<!--.*?-->', '', html, flags=re.DOTALL)
-    # Collapse multiple spaces/newlines to single space
-    html = re.sub(r'\s+', ' ', html)
-    # Remove spaces around tags
-    html = re.sub(r'>\s+<', '><', html)
-    # Trim
-    html = html.strip()
-    print(html, end='')
-")
-    
-    HTML_CONTENTS["$filename"]="$minified"
-    minified_size=$(echo -n "$minified" | wc -c)
-    
-    # Gzip compress
-    gzipped=$(gzip_to_c_array "$minified")
-    HTML_GZIP_CONTENTS["$filename"]="$gzipped"
-    gzipped_size=$(echo -n "$minified" | gzip -9 -c | wc -c)
-    
-    ORIGINAL_SIZES["html_$filename"]=$original_size
-    PROCESSED_SIZES["html_$filename"]=$minified_size
-    GZIPPED_SIZES["html_$filename"]=$gzipped_size
-done
+# Short content hash of processed (pre-gzip) content. Used as the asset's
+# strong ETag and as the ?v= cache-busting token for CSS/JS links in HTML.
+content_hash() {
+    printf '%s' "$1" | sha256sum | cut -c1-16
+}
 
 # Process CSS files (minify)
 for css_file in "${CSS_FILES[@]}"; do
@@ -262,6 +216,7 @@ with open('$css_file', 'r') as f:
     ORIGINAL_SIZES["css_$filename"]=$original_size
     PROCESSED_SIZES["css_$filename"]=$minified_size
     GZIPPED_SIZES["css_$filename"]=$gzipped_size
+    ASSET_HASHES["css_$filename"]=$(content_hash "$minified")
 done
 
 # Process JS files (minify)
@@ -290,6 +245,76 @@ with open('$js_file', 'r') as f:
     ORIGINAL_SIZES["js_$filename"]=$original_size
     PROCESSED_SIZES["js_$filename"]=$minified_size
     GZIPPED_SIZES["js_$filename"]=$gzipped_size
+    ASSET_HASHES["js_$filename"]=$(content_hash "$minified")
+done
+
+# Versioned CSS/JS URLs for HTML: "/portal.css" -> "/portal.css?v=<hash>".
+# CSS and JS are processed first so their hashes are known here; a changed
+# stylesheet or script changes the URL, so those can be cached long-term.
+ASSET_VERSIONS=""
+for key in "${!ASSET_HASHES[@]}"; do
+    ASSET_VERSIONS+="${key#*_}.${key%%_*}=${ASSET_HASHES[$key]} "
+done
+export ASSET_VERSIONS
+
+# Process HTML files (template substitution + minification)
+for html_file in "${HTML_FILES[@]}"; do
+    filename=$(basename "$html_file" .html)
+    echo "Processing HTML: $filename.html..."
+    content=$(cat "$html_file")
+    original_size=$(echo -n "$content" | wc -c)
+    
+    # Template substitution and minification
+    minified=$(python3 -c "
+import os
+import re
+import sys
+
+# Read template fragments from environment or files
+header_template = '''$HEADER_TEMPLATE'''
+nav_template = '''$NAV_TEMPLATE'''
+footer_template = '''$FOOTER_TEMPLATE'''
+
+with open('$html_file', 'r') as f:
+    html = f.read()
+    
+    # Replace template placeholders with actual content
+    html = html.replace('{{HEADER}}', header_template)
+    html = html.replace('{{NAV}}', nav_template)
+    html = html.replace('{{FOOTER}}', footer_template)
+    
+    # Project name substitution
+    html = html.replace('{{PROJECT_NAME}}', '$PROJECT_NAME')
+    html = html.replace('{{PROJECT_DISPLAY_NAME}}', '$PROJECT_DISPLAY_NAME')
+
+    # Versioned CSS/JS references (see ASSET_VERSIONS)
+    for entry in os.environ.get('ASSET_VERSIONS', '').split():
+        asset, version = entry.split('=', 1)
+        html = html.replace('\"/' + asset + '\"', '\"/' + asset + '?v=' + version + '\"')
+    
+    # Remove HTML comments
+    html = re.sub(r'<!--.*?-->', '', html, flags=re.DOTALL)
+    # Collapse multiple spaces/newlines to single space
+    html = re.sub(r'\s+', ' ', html)
+    # Remove spaces around tags
+    html = re.sub(r'>\s+<', '><', html)
+    # Trim
+    html = html.strip()
+    print(html, end='')
+")
+    
+    HTML_CONTENTS["$filename"]="$minified"
+    minified_size=$(echo -n "$minified" | wc -c)
+    
+    # Gzip compress
+    gzipped=$(gzip_to_c_array "$minified")
+    HTML_GZIP_CONTENTS["$filename"]="$gzipped"
+    gzipped_size=$(echo -n "$minified" | gzip -9 -c | wc -c)
+    
+    ORIGINAL_SIZES["html_$filename"]=$original_size
+    PROCESSED_SIZES["html_$filename"]=$minified_size
+    GZIPPED_SIZES["html_$filename"]=$gzipped_size
+    ASSET_HASHES["html_$filename"]=$(content_hash "$minified")
 done
 
 echo
@@ -376,6 +401,7 @@ cat > "$OUTPUT_FILE" << 'HEADER_START'
  *   - HTML files: template substitution + basic minification + gzip compression
  *   - CSS files:  minified using csscompressor + gzip compression
  *   - JS files:   minified using rjsmin + gzip compression
+ *   - HTML links to CSS/JS carry ?v=<content hash> for long-lived caching
  * 
  * All assets are stored in gzipped format with Content-Encoding: gzip headers.
  * This reduces flash storage and bandwidth by 60-80%.
@@ -449,6 +475,24 @@ for filename in "${!JS_CONTENTS[@]}"; do
     echo "const size_t ${filename}_js_gz_len = sizeof(${filename}_js_gz);" >> "$OUTPUT_FILE"
 done
 
+# Add content hashes (strong ETags, quoted as sent in the header)
+cat >> "$OUTPUT_FILE" << 'ETAG_CONSTANTS'
+
+// Asset ETags (content hash of the minified source, quoted)
+ETAG_CONSTANTS
+
+for filename in "${!HTML_CONTENTS[@]}"; do
+    echo "const char ${filename}_html_etag[] = \"\\\"${ASSET_HASHES[html_$filename]}\\\"\";" >> "$OUTPUT_FILE"
+done
+
+for filename in "${!CSS_CONTENTS[@]}"; do
+    echo "const char ${filename}_css_etag[] = \"\\\"${ASSET_HASHES[css_$filename]}\\\"\";" >> "$OUTPUT_FILE"
+done
+
+for filename in "${!JS_CONTENTS[@]}"; do
+    echo "const char ${filename}_js_etag[] = \"\\\"${ASSET_HASHES[js_$filename]}\\\"\";" >> "$OUTPUT_FILE"
+done
+
 # Close header file
 cat >> "$OUTPUT_FILE" << 'HEADER_END'
 
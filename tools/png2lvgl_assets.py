@@ -1,11 +1,17 @@
 #!/usr/bin/env python3
 """Convert top-level PNG files to LVGL 9.x image descriptors.
 
+Images are emitted as RGB565A8 planes, either raw or compressed (--compress).
+Compressed images carry LV_IMAGE_FLAGS_USER1 and a small blob header (see
+src/app/asset_codec.h); the firmware's asset decoder (lvgl_asset_decoder.cpp)
+inflates them into a size-bounded PSRAM cache on first draw.
 
 Requirements:
+    Python 3 + Pillow
 
 Example:
     python3 tools/png2lvgl_assets.py assets/png src/app/png_assets.cpp src/app/png_assets.h --prefix img_
+    python3 tools/png2lvgl_assets.py assets/png src/app/png_assets.cpp src/app/png_assets.h --compress auto
 """
 
 from __future__ import annotations
@@ -13,6 +19,7 @@ from __future__ import annotations
 import argparse
 import os
 import re
+import struct
 import sys
 from dataclasses import dataclass
 from typing import List, Tuple
@@ -35,18 +42,213 @@ except Exception as exc:  # pragma: no cover
 
 _VALID_C_IDENT = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
 
+# Blob method ids (must match src/app/asset_codec.h).
+_METHOD_IDS = {"rle": 1, "lz4": 2}
+
+# Rough ESP32-S3 (240 MHz, decoding into PSRAM) throughput used for the
+# per-asset decode estimate. Real numbers are reported by the firmware
+# (display_img_decode_us_* in /api/health); adjust these if they disagree.
+_DECODE_BYTES_PER_US = {"rle": 40.0, "lz4": 25.0}
+_DECODE_US_PER_TOKEN = {"rle": 0.05, "lz4": 0.15}
+
 
 @dataclass(frozen=True)
 class LvglImage:
     symbol: str
     width: int
     height: int
-    data: bytes
+    data: bytes          # What goes into the C array (raw planes or blob)
+    raw_size: int        # Decoded RGB565A8 size
+    method: str          # "none", "rle" or "lz4"
+    est_decode_us: int   # 0 for raw images
     stride: int
     map_name: str
     source_file: str
 
 
+# ---------------------------------------------------------------------------
+# Compression (decoders mirror src/app/asset_codec.h and are used to verify)
+# ---------------------------------------------------------------------------
+
+def _rle_encode(data: bytes, unit: int) -> Tuple[bytes, int]:
+    """RLE over `unit`-byte elements. Returns (stream, control tokens)."""
+    elems = [data[i : i + unit] for i in range(0, len(data), unit)]
+    out = bytearray()
+    tokens = 0
+    i = 0
+    n = len(elems)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and elems[i + run] == elems[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += elems[i]
+            i += run
+        else:
+            start = i
+            i += 1
+            # Extend the literal until a run of >= 3 starts (2-runs are cheaper inline).
+            while i < n and i - start < 128:
+                if i + 2 < n and elems[i] == elems[i + 1] == elems[i + 2]:
+                    break
+                i += 1
+            out.append(i - start - 1)
+            for e in elems[start:i]:
+                out += e
+        tokens += 1
+    return bytes(out), tokens
+
+
+def _rle_decode(src: bytes, pos: int, size: int, unit: int) -> Tuple[bytes, int]:
+    out = bytearray()
+    while len(out) < size:
+        c = src[pos]
+        pos += 1
+        count = (c & 0x7F) + 1
+        if c & 0x80:
+            out += src[pos : pos + unit] * count
+            pos += unit
+        else:
+            out += src[pos : pos + count * unit]
+            pos += count * unit
+    return bytes(out), pos
+
+
+_LZ4_MINMATCH = 4
+_LZ4_LASTLITERALS = 5
+_LZ4_MFLIMIT = 12
+
+
+def _lz4_compress(src: bytes) -> Tuple[bytes, int]:
+    """Greedy single-block LZ4 compressor. Returns (block, sequences)."""
+    n = len(src)
+    out = bytearray()
+    sequences = 0
+
+    def write_len(v: int) -> None:
+        while v >= 255:
+            out.append(255)
+            v -= 255
+        out.append(v)
+
+    def emit(lit_start: int, lit_end: int, offset: int = 0, mlen: int = 0) -> None:
+        lit = lit_end - lit_start
+        ml = mlen - _LZ4_MINMATCH if mlen else 0
+        out.append((min(lit, 15) << 4) | min(ml, 15))
+        if lit >= 15:
+            write_len(lit - 15)
+        out.extend(src[lit_start:lit_end])
+        if mlen:
+            out.extend(struct.pack("<H", offset))
+            if ml >= 15:
+                write_len(ml - 15)
+
+    table = {}
+    anchor = 0
+    i = 0
+    last_match_start = n - _LZ4_MFLIMIT  # Matches must start before this
+    while i < last_match_start:
+        key = src[i : i + _LZ4_MINMATCH]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > 0xFFFF:
+            i += 1
+            continue
+        mlen = _LZ4_MINMATCH
+        max_len = n - _LZ4_LASTLITERALS - i
+        while mlen < max_len and src[cand + mlen] == src[i + mlen]:
+            mlen += 1
+        emit(anchor, i, i - cand, mlen)
+        sequences += 1
+        i += mlen
+        anchor = i
+        if i - 2 < last_match_start:
+            table[src[i - 2 : i - 2 + _LZ4_MINMATCH]] = i - 2
+    emit(anchor, n)
+    sequences += 1
+    return bytes(out), sequences
+
+
+def _lz4_decode(src: bytes, size: int) -> bytes:
+    out = bytearray()
+    si = 0
+    while si < len(src):
+        token = src[si]
+        si += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[si]
+                si += 1
+                lit += b
+                if b != 255:
+                    break
+        out += src[si : si + lit]
+        si += lit
+        if si == len(src):
+            break
+        offset = src[si] | (src[si + 1] << 8)
+        si += 2
+        mlen = token & 0x0F
+        if mlen == 15:
+            while True:
+                b = src[si]
+                si += 1
+                mlen += b
+                if b != 255:
+                    break
+        mlen += _LZ4_MINMATCH
+        start = len(out) - offset
+        for k in range(mlen):
+            out.append(out[start + k])
+    if len(out) != size:
+        raise ValueError("LZ4 round trip size mismatch")
+    return bytes(out)
+
+
+def _encode(method: str, raw: bytes, rgb_plane_size: int) -> Tuple[bytes, int]:
+    """Build a blob (header + payload). Returns (blob, decode tokens)."""
+    if method == "rle":
+        part0, t0 = _rle_encode(raw[:rgb_plane_size], 2)
+        part1, t1 = _rle_encode(raw[rgb_plane_size:], 1)
+        payload = part0 + part1
+        tokens = t0 + t1
+        header = b"AC" + bytes((_METHOD_IDS[method], 2)) + struct.pack("<II", len(raw), rgb_plane_size)
+        decoded0, pos = _rle_decode(payload, 0, rgb_plane_size, 2)
+        decoded1, pos = _rle_decode(payload, pos, len(raw) - rgb_plane_size, 1)
+        if decoded0 + decoded1 != raw or pos != len(payload):
+            raise SystemExit("ERROR: RLE round trip failed (converter bug)")
+    else:
+        payload, tokens = _lz4_compress(raw)
+        header = b"AC" + bytes((_METHOD_IDS[method], 0)) + struct.pack("<II", len(raw), 0)
+        if _lz4_decode(payload, len(raw)) != raw:
+            raise SystemExit("ERROR: LZ4 round trip failed (converter bug)")
+    return header + payload, tokens
+
+
+def _estimate_decode_us(method: str, raw_size: int, tokens: int) -> int:
+    return int(raw_size / _DECODE_BYTES_PER_US[method] + tokens * _DECODE_US_PER_TOKEN[method])
+
+
+def _choose_encoding(raw: bytes, rgb_plane_size: int, mode: str, min_bytes: int) -> Tuple[str, bytes, int]:
+    """Returns (method, data, est_decode_us) for the requested --compress mode."""
+    if mode == "none" or len(raw) < min_bytes:
+        return "none", raw, 0
+
+    candidates = ["rle", "lz4"] if mode == "auto" else [mode]
+    best = ("none", raw, 0)
+    for method in candidates:
+        blob, tokens = _encode(method, raw, rgb_plane_size)
+        if len(blob) < len(best[1]):
+            best = (method, blob, _estimate_decode_us(method, len(raw), tokens))
+
+    # auto: only worth a decode + cache slot if it saves at least 10%.
+    if mode == "auto" and best[0] != "none" and len(best[1]) > len(raw) * 0.9:
+        return "none", raw, 0
+    return best
+
+
 def _read_png_to_rgb565a8_bytes(png_path: str) -> Tuple[int, int, int, bytes]:
     """Convert PNG to LVGL 9.x RGB565A8 format.
 
@@ -123,6 +325,9 @@ def _write_header(path_h: str, images: List[LvglImage]) -> None:
         f.write("extern \"C\" {\n")
         f.write("#endif\n\n")
         f.write("// PNG asset declarations\n")
+        if any(img.method != "none" for img in images):
+            f.write("// Compressed (LV_IMAGE_FLAGS_USER1) images: set them through lvgl_asset_src()\n")
+            f.write("// (lvgl_asset_decoder.h) so they are never drawn without the decoder.\n")
         for img in images:
             f.write(f"extern const lv_image_dsc_t {img.symbol};\n")
         f.write("\n#ifdef __cplusplus\n")
@@ -153,6 +358,11 @@ def _write_c(path_c: str, header_basename: str, images: List[LvglImage]) -> None
 
         for img in images:
             f.write(f"// {img.width}x{img.height} RGBA PNG: {os.path.basename(img.source_file)}\n")
+            if img.method != "none":
+                f.write(
+                    f"// {img.method.upper()} compressed: {img.raw_size} -> {len(img.data)} bytes "
+                    "(inflated by lvgl_asset_decoder.cpp)\n"
+                )
             f.write(
                 f"const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ uint8_t {img.map_name}[] = {{\n"
             )
@@ -174,7 +384,7 @@ def _write_c(path_c: str, header_basename: str, images: List[LvglImage]) -> None
             f.write("  .header = {\n")
             f.write("    .magic = LV_IMAGE_HEADER_MAGIC,\n")
             f.write("    .cf = LV_COLOR_FORMAT_RGB565A8,\n")
-            f.write("    .flags = 0,\n")
+            f.write("    .flags = LV_IMAGE_FLAGS_USER1,\n" if img.method != "none" else "    .flags = 0,\n")
             f.write(f"    .w = {img.width},\n")
             f.write(f"    .h = {img.height},\n")
             f.write(f"    .stride = {img.stride},\n")
@@ -193,6 +403,19 @@ def main() -> int:
     ap.add_argument("output_c", help="Output .c file path")
     ap.add_argument("output_h", help="Output .h file path")
     ap.add_argument("--prefix", default="img_", help="Symbol name prefix (default: img_)")
+    ap.add_argument(
+        "--compress",
+        choices=["none", "rle", "lz4", "auto"],
+        default="none",
+        help="Image compression (default: none). auto picks the smaller of rle/lz4 "
+        "and keeps an image raw unless it saves at least 10%%",
+    )
+    ap.add_argument(
+        "--compress-min-bytes",
+        type=int,
+        default=4096,
+        help="Keep images smaller than this raw (default: 4096)",
+    )
 
     args = ap.parse_args()
 
@@ -225,7 +448,8 @@ def main() -> int:
             )
         seen_symbols.add(symbol)
 
-        width, height, stride, data = _read_png_to_rgb565a8_bytes(png_path)
+        width, height, stride, raw = _read_png_to_rgb565a8_bytes(png_path)
+        method, data, est_us = _choose_encoding(raw, stride * height, args.compress, args.compress_min_bytes)
 
         images.append(
             LvglImage(
@@ -233,6 +457,9 @@ def main() -> int:
                 width=width,
                 height=height,
                 data=data,
+                raw_size=len(raw),
+                method=method,
+                est_decode_us=est_us,
                 stride=stride,
                 map_name=f"{symbol}_map",
                 source_file=png_path,
@@ -246,16 +473,25 @@ def main() -> int:
     _write_header(output_h, images)
     _write_c(output_c, os.path.basename(output_h), images)
 
-    print(f"✓ PNG assets: {len(images)} file(s)")
+    print(f"✓ PNG assets: {len(images)} file(s) (compress={args.compress})")
     total_bytes = 0
+    total_raw = 0
     for img in images:
         size_bytes = len(img.data)
         total_bytes += size_bytes
-        print(
+        total_raw += img.raw_size
+        line = (
             f"  - {os.path.basename(img.source_file)} -> {img.symbol} "
             f"({img.width}x{img.height}) : {size_bytes} bytes in firmware"
         )
-    print(f"✓ PNG assets total: {total_bytes} bytes in firmware")
+        if img.method != "none":
+            line += (
+                f" ({img.method}, raw {img.raw_size}, {100.0 * size_bytes / img.raw_size:.1f}%, "
+                f"est. decode ~{img.est_decode_us} us)"
+            )
+        print(line)
+    saved = f", raw {total_raw}" if total_raw != total_bytes else ""
+    print(f"✓ PNG assets total: {total_bytes} bytes in firmware{saved}")
     print(f"✓ Wrote {output_h}")
     print(f"✓ Wrote {output_c}")
 
@@ -13,6 +13,11 @@ Scenarios:
 - api:    hits API endpoints only (JSON churn focus)
 - portal: fetches HTML/CSS/JS pages in addition to API calls (portal load)
  - https_image: queues an HTTP/HTTPS JPEG download via /api/display/image_url
+- json:   times back-to-back GETs of the chunked JSON endpoints (/api/health, /api/config)
+          and reports response bytes/s, for before/after firmware comparisons
+
+With --user/--password every request carries Basic Auth, and the run ends with the
+device-side cost of the portal auth gate (portal_auth_* health fields) over the run.
 
 Notes:
 - Requires --no-reboot and always uses ?no_reboot=1 when saving config.
@@ -22,6 +27,7 @@ Notes:
 from __future__ import annotations
 
 import argparse
+import base64
 import csv
 import json
 import os
@@ -40,6 +46,9 @@ DEFAULT_TIMEOUT_S = 5.0
 DEFAULT_RETRIES = 3
 DEFAULT_RETRY_SLEEP_S = 0.25
 
+# "Basic ..." header sent with every request (--user/--password), or None.
+_AUTH_HEADER: Optional[str] = None
+
 
 def _repo_root() -> str:
     # tools/portal_stress_test.py -> repo root
@@ -233,6 +242,8 @@ def _http(
         headers["Accept"] = accept
     if content_type:
         headers["Content-Type"] = content_type
+    if _AUTH_HEADER:
+        headers["Authorization"] = _AUTH_HEADER
 
     req = Request(url=url, data=body, headers=headers, method=method)
 
@@ -371,6 +382,75 @@ def fetch_portal_assets(base_url: str, timeout_s: float, retries: int, retry_sle
             raise RuntimeError(f"GET {path} failed: HTTP {status}")
 
 
+def time_json_gets(
+    base_url: str,
+    reps: int,
+    totals: Dict[str, list[float]],
+    timeout_s: float,
+    retries: int,
+    retry_sleep_s: float,
+) -> None:
+    # totals[path] = [requests, bytes, seconds]
+    for path in ("/api/health", "/api/config"):
+        t = totals.setdefault(path, [0, 0, 0.0])
+        for _ in range(reps):
+            t0 = time.perf_counter()
+            status, data = _http(
+                base_url,
+                method="GET",
+                path=path,
+                timeout_s=timeout_s,
+                accept="application/json",
+                retries=retries,
+                retry_sleep_s=retry_sleep_s,
+            )
+            dt = time.perf_counter() - t0
+            if status != 200:
+                raise RuntimeError(f"GET {path} failed: HTTP {status}")
+            t[0] += 1
+            t[1] += len(data)
+            t[2] += dt
+
+
+def summarize_json_throughput(totals: Dict[str, list[float]]) -> None:
+    if not totals:
+        return
+    print("\nJSON response throughput (request start to last byte):")
+    for path, (n, nbytes, secs) in totals.items():
+        if not n or secs <= 0:
+            continue
+        print(
+            f"  {path:12s} requests={int(n)} avg_bytes={int(nbytes / n)} "
+            f"avg_ms={secs * 1000.0 / n:.1f} bytes_per_s={int(nbytes / secs)}"
+        )
+
+
+def summarize_auth_gate(before: Dict[str, Any], after: Dict[str, Any]) -> None:
+    # Counters are since boot; report the run's share.
+    if "portal_auth_checks" not in after:
+        return
+
+    def _delta(key: str) -> int:
+        return int(after.get(key) or 0) - int(before.get(key) or 0)
+
+    checks = _delta("portal_auth_checks")
+    print("\nAuth gate (device-side, this run):")
+    if checks <= 0:
+        print("  no checks (auth disabled, or AP mode)")
+        return
+    cache_hits = _delta("portal_auth_cache_hits")
+    memo_hits = _delta("portal_auth_memo_hits")
+    print(
+        f"  checks={checks} cache_hits={cache_hits} ({cache_hits * 100 // checks}%) "
+        f"memo_hits={memo_hits} verifies={_delta('portal_auth_verifies')} "
+        f"failures={_delta('portal_auth_failures')}"
+    )
+    print(
+        f"  avg_us={_delta('portal_auth_us_total') / checks:.1f} "
+        f"max_us_since_boot={after.get('portal_auth_max_us')}"
+    )
+
+
 def extract_sample(
     cycle: int,
     phase: str,
@@ -491,13 +571,20 @@ def main(argv: list[str]) -> int:
     p.add_argument("--cycles", type=int, default=10, help="Number of stress cycles (default: 10)")
     p.add_argument(
         "--scenario",
-        choices=("api", "portal", "both", "image", "https_image"),
+        choices=("api", "portal", "both", "image", "https_image", "json"),
         default="api",
         help=(
             "Stress scenario: api (JSON churn), portal (fetch pages+assets), both (portal + api), "
-            "image (full image upload), https_image (queue HTTPS download)."
+            "image (full image upload), https_image (queue HTTPS download), "
+            "json (time JSON endpoint GETs)."
         ),
     )
+    p.add_argument(
+        "--json-reps",
+        type=int,
+        default=20,
+        help="For --scenario json: GETs per endpoint per cycle (default: 20)",
+    )
 
     p.add_argument(
         "--image-generate",
@@ -524,6 +611,8 @@ def main(argv: list[str]) -> int:
         action="store_true",
         help="For --image-generate: generate a high-entropy noise image (less compressible)",
     )
+    p.add_argument("--user", default=None, help="Basic Auth username (when portal auth is enabled)")
+    p.add_argument("--password", default="", help="Basic Auth password (with --user)")
     p.add_argument("--sleep", type=float, default=0.5, help="Sleep between steps in seconds (default: 0.5)")
     p.add_argument("--timeout", type=float, default=DEFAULT_TIMEOUT_S, help="HTTP timeout seconds (default: 5)")
     p.add_argument("--retries", type=int, default=DEFAULT_RETRIES, help="Retries per request (default: 3)")
@@ -546,6 +635,11 @@ def main(argv: list[str]) -> int:
 
     base_url = _normalize_base_url(args.host)
 
+    if args.user:
+        global _AUTH_HEADER
+        token = base64.b64encode(f"{args.user}:{args.password}".encode("utf-8")).decode("ascii")
+        _AUTH_HEADER = f"Basic {token}"
+
     print(f"Target: {base_url}")
     print(f"Scenario: {args.scenario}")
     print(f"Cycles: {args.cycles}")
@@ -555,6 +649,8 @@ def main(argv: list[str]) -> int:
         print(f"Image URL: {args.image_url}")
 
     samples: list[HealthSample] = []
+    json_totals: Dict[str, list[float]] = {}
+    health0: Dict[str, Any] = {}
 
     try:
         # Baseline samples
@@ -589,6 +685,20 @@ def main(argv: list[str]) -> int:
 
     try:
         for i in range(1, args.cycles + 1):
+            if args.scenario == "json":
+                time_json_gets(
+                    base_url,
+                    args.json_reps,
+                    json_totals,
+                    timeout_s=args.timeout,
+                    retries=args.retries,
+                    retry_sleep_s=args.retry_sleep,
+                )
+                health = get_health(base_url, timeout_s=args.timeout, retries=args.retries, retry_sleep_s=args.retry_sleep)
+                samples.append(extract_sample(cycle=i, phase="after_cycle", health=health))
+                print(f"cycle {i:3d}/{args.cycles}: heap_largest={samples[-1].heap_largest}")
+                continue
+
             if args.scenario in ("portal", "both"):
                 fetch_portal_assets(base_url, timeout_s=args.timeout, retries=args.retries, retry_sleep_s=args.retry_sleep)
                 time.sleep(args.sleep)
@@ -682,6 +792,13 @@ def main(argv: list[str]) -> int:
             print(f"cycle {i:3d}/{args.cycles}: heap_largest={hl} heap_fragmentation={frag}")
     finally:
         summarize(samples)
+        summarize_json_throughput(json_totals)
+        if health0:
+            try:
+                health_end = get_health(base_url, timeout_s=args.timeout, retries=args.retries, retry_sleep_s=args.retry_sleep)
+                summarize_auth_gate(health0, health_end)
+            except Exception as e:
+                print(f"\nAuth gate: final /api/health failed: {e}", file=sys.stderr)
 
     if args.out:
         write_csv(args.out, samples)